@@ -1,24 +1,75 @@
 #include "SSD1289.h"
 
-#define LCD_REG      (*((volatile unsigned short *) 0x60000000))
-#define LCD_RAM      (*((volatile unsigned short *) 0x60020000))
-
 #define MAX_POLY_CORNERS   200
-#define POLY_Y(Z)          ((int32_t)((Points + Z)->X))
-#define POLY_X(Z)          ((int32_t)((Points + Z)->Y))
-#define ABS(X)  ((X) > 0 ? (X) : -(X))
+#define POLY_X(Z)          ((int32_t)((Points + Z)->X))
+#define POLY_Y(Z)          ((int32_t)((Points + Z)->Y))
 
 /* Global variables to set the written text color */
 __IO uint16_t TextColor = 0x0000;
 __IO uint16_t BackColor = 0xFFFF;
-__IO uint16_t asciisize = 16;
+__IO uint16_t asciisize = 16;   /* text height in pixels, a multiple of the font height */
+static const LCD_Font *LCD_CurrentFont = &LCD_Font6x8;
+static const LCD_FontAA *LCD_CurrentFontAA = &LCD_FontAA12x16;
+
+/* Coverage to RGB565 ramp for the current TextColor/BackColor pair */
+static uint16_t LCD_AARamp[16];
+static uint16_t LCD_AARampText = 0x0000;
+static uint16_t LCD_AARampBack = 0x0000;
+static uint8_t  LCD_AARampValid = 0;
+/* FSMC timing in use, see LCD_FSMCCalibrate() */
+LCD_FSMCTiming LCD_FSMCRead = {LCD_FSMC_READ_ADDSET, LCD_FSMC_READ_DATAST};
+LCD_FSMCTiming LCD_FSMCWrite = {LCD_FSMC_ADDSET, LCD_FSMC_DATAST};
+static const LCD_FSMCTiming LCD_FSMCDefaultRead = {LCD_FSMC_READ_ADDSET, LCD_FSMC_READ_DATAST};
+static const LCD_FSMCTiming LCD_FSMCDefaultWrite = {LCD_FSMC_ADDSET, LCD_FSMC_DATAST};
 uint16_t TimerPeriod    = 0;
 uint16_t Channel3Pulse  = 0;
 
+#ifndef LCD_SIMULATOR
 TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
 TIM_OCInitTypeDef  TIM_OCInitStructure;
+#endif
+
+/* State of the running DMA transfer into GRAM */
+static __IO uint16_t LCD_DMAColor      = 0x0000;
+static const uint16_t *LCD_DMASource   = 0;     /* start of the next chunk */
+static const uint16_t *LCD_DMARowStart = 0;
+static uint8_t  LCD_DMASourceInc       = 0;
+static uint32_t LCD_DMARowLength       = 0;
+static uint32_t LCD_DMAStride          = 0;
+static __IO uint32_t LCD_DMARemaining  = 0;     /* pixels left in the current row */
+static __IO uint16_t LCD_DMARows       = 0;     /* rows left after the current one */
+static __IO uint8_t  LCD_DMAActive     = 0;
+static LCD_DMACallback LCD_DMADone     = 0;
+
+/* Polygon edge for the scanline filler, x and slope in 16.16 fixed point */
+typedef struct {
+    int64_t x;          /* x at the center of the current scanline, 16.16 */
+    int64_t dxdy;       /* 16.16, |dx| can reach 65535 */
+    int16_t y_top;      /* first scanline */
+    int16_t y_bottom;   /* first scanline below the edge */
+} LCD_PolyEdge;
+
+static LCD_PolyEdge LCD_PolyEdges[MAX_POLY_CORNERS];
+static LCD_PolyEdge *LCD_PolyActive[MAX_POLY_CORNERS];
+
+/* Run of outline pixels in one quadrant, a single row or a single column */
+typedef struct {
+    int32_t x0, x1;
+    int32_t y0, y1;
+    uint8_t used;
+} LCD_ArcRun;
+
+/* Hardware scroll region (screen columns) and position */
+static uint16_t LCD_ScrollX0           = 0;
+static uint16_t LCD_ScrollWidth        = LCD_PIXEL_WIDTH;
+static uint16_t LCD_ScrollLines        = 0;
 //****************************************************************************//
 
+/*
+ * Pins, FSMC, SysTick and backlight timer. The host simulator (sim/) has its
+ * own versions of these.
+ */
+#ifndef LCD_SIMULATOR
 void LCD_CtrlLinesConfig(void) {
     GPIO_InitTypeDef GPIO_InitStructure;
     RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOD | RCC_AHB1Periph_GPIOG |
@@ -71,18 +122,28 @@ void LCD_CtrlLinesConfig(void) {
     
 }
 
-void LCD_FSMCConfig(void) {
+/*
+ * Program FSMC bank 1 for the panel. Extended mode A gives reads their own
+ * timing (BTR) so the slow RD cycle of the SSD1289 does not hold back
+ * writes (BWTR), which carry every pixel.
+ */
+void LCD_FSMCSetTiming(const LCD_FSMCTiming *read, const LCD_FSMCTiming *write) {
     
     FSMC_NORSRAMInitTypeDef  FSMC_NORSRAMInitStructure;
     FSMC_NORSRAMTimingInitTypeDef FSMC_NORSRAMTimingInitStructure;
-    FSMC_NORSRAMTimingInitStructure.FSMC_AddressSetupTime = 0;  //0
+    FSMC_NORSRAMTimingInitTypeDef FSMC_NORSRAMWriteTimingStructure;
+    FSMC_NORSRAMTimingInitStructure.FSMC_AddressSetupTime = read->addset;
     FSMC_NORSRAMTimingInitStructure.FSMC_AddressHoldTime = 0;   //0
-    FSMC_NORSRAMTimingInitStructure.FSMC_DataSetupTime = 2;     //3
+    FSMC_NORSRAMTimingInitStructure.FSMC_DataSetupTime = read->datast;
     FSMC_NORSRAMTimingInitStructure.FSMC_BusTurnAroundDuration = 0;
     FSMC_NORSRAMTimingInitStructure.FSMC_CLKDivision = 1;//1
     FSMC_NORSRAMTimingInitStructure.FSMC_DataLatency = 0;
     FSMC_NORSRAMTimingInitStructure.FSMC_AccessMode = FSMC_AccessMode_A;
     
+    FSMC_NORSRAMWriteTimingStructure = FSMC_NORSRAMTimingInitStructure;
+    FSMC_NORSRAMWriteTimingStructure.FSMC_AddressSetupTime = write->addset;
+    FSMC_NORSRAMWriteTimingStructure.FSMC_DataSetupTime = write->datast;
+    
     FSMC_NORSRAMInitStructure.FSMC_Bank = FSMC_Bank1_NORSRAM1;
     FSMC_NORSRAMInitStructure.FSMC_DataAddressMux = FSMC_DataAddressMux_Disable;
     FSMC_NORSRAMInitStructure.FSMC_MemoryType = FSMC_MemoryType_SRAM;
@@ -94,21 +155,12 @@ void LCD_FSMCConfig(void) {
     FSMC_NORSRAMInitStructure.FSMC_WriteOperation = FSMC_WriteOperation_Enable;
     FSMC_NORSRAMInitStructure.FSMC_WaitSignal = FSMC_WaitSignal_Disable;
     FSMC_NORSRAMInitStructure.FSMC_AsynchronousWait = FSMC_AsynchronousWait_Disable;
-    FSMC_NORSRAMInitStructure.FSMC_ExtendedMode = FSMC_ExtendedMode_Disable;
+    FSMC_NORSRAMInitStructure.FSMC_ExtendedMode = FSMC_ExtendedMode_Enable;
     FSMC_NORSRAMInitStructure.FSMC_WriteBurst = FSMC_WriteBurst_Enable;//disable
     FSMC_NORSRAMInitStructure.FSMC_ReadWriteTimingStruct = &FSMC_NORSRAMTimingInitStructure;
+    FSMC_NORSRAMInitStructure.FSMC_WriteTimingStruct = &FSMC_NORSRAMWriteTimingStructure;
     
     FSMC_NORSRAMInit(&FSMC_NORSRAMInitStructure);
-    FSMC_NORSRAMTimingInitStructure.FSMC_AddressSetupTime = 0;    //0
-    FSMC_NORSRAMTimingInitStructure.FSMC_AddressHoldTime = 0;	//0
-    FSMC_NORSRAMTimingInitStructure.FSMC_DataSetupTime = 4;	//3
-    FSMC_NORSRAMTimingInitStructure.FSMC_BusTurnAroundDuration = 0;
-    FSMC_NORSRAMTimingInitStructure.FSMC_CLKDivision = 1;//1
-    FSMC_NORSRAMTimingInitStructure.FSMC_DataLatency = 0;
-    FSMC_NORSRAMTimingInitStructure.FSMC_AccessMode = FSMC_AccessMode_A;
-    FSMC_NORSRAMInitStructure.FSMC_WriteTimingStruct = &FSMC_NORSRAMTimingInitStructure;
-    FSMC_NORSRAMInit(&FSMC_NORSRAMInitStructure);
-    
     FSMC_NORSRAMCmd(FSMC_Bank1_NORSRAM1, ENABLE);
 }
 
@@ -153,96 +205,1093 @@ void TIM_Config(void) {
     TIM_CtrlPWMOutputs(TIM1, ENABLE);
     
 }
+#endif /* LCD_SIMULATOR */
+
+void LCD_FSMCConfig(void) {
+    LCD_FSMCRead = LCD_FSMCDefaultRead;
+    LCD_FSMCWrite = LCD_FSMCDefaultWrite;
+    LCD_FSMCSetTiming(&LCD_FSMCRead, &LCD_FSMCWrite);
+}
+
+/* Test word "index" of a calibration pattern */
+static uint16_t LCD_CalPattern(uint8_t pattern, uint16_t index) {
+    switch (pattern) {
+    case 0:  return 1 << (index & 15);                  /* walking one on DB0-DB15 */
+    case 1:  return ~(1 << (index & 15));               /* walking zero */
+    case 2:  return (index & 1) ? 0xAAAA : 0x5555;      /* checkerboard, every line toggles */
+    default: return (index & 1) ? 0xFFFF : 0x0000;      /* all lines at once */
+    }
+}
+
+/*
+ * Write the test patterns to the first LCD_CAL_PIXELS pixels of the top row
+ * with the "write" timing and read them back with the "read" timing. Window
+ * and index writes run at the default timing, so a bad setting can only
+ * corrupt GRAM data and never reach another register.
+ */
+static uint8_t LCD_CalVerify(const LCD_FSMCTiming *read, const LCD_FSMCTiming *write) {
+    uint8_t pattern, ok = 1;
+    uint16_t index;
+    
+    for (pattern = 0; pattern < 4 && ok; pattern++) {
+        LCD_SetWindow(0, 0, LCD_CAL_PIXELS, 1);
+        LCD_FSMCSetTiming(read, write);
+        for (index = 0; index < LCD_CAL_PIXELS; index++)
+            LCD_WRITE_DATA(LCD_CalPattern(pattern, index));
+        LCD_FSMCSetTiming(&LCD_FSMCDefaultRead, &LCD_FSMCDefaultWrite);
+        
+        LCD_SetWindow(0, 0, LCD_CAL_PIXELS, 1);
+        LCD_FSMCSetTiming(read, write);
+        LCD_READ_DATA();    /* dummy read after R22h */
+        for (index = 0; index < LCD_CAL_PIXELS; index++) {
+            if (LCD_READ_DATA() != LCD_CalPattern(pattern, index)) {
+                ok = 0;
+                break;
+            }
+        }
+        LCD_FSMCSetTiming(&LCD_FSMCDefaultRead, &LCD_FSMCDefaultWrite);
+    }
+    return ok;
+}
+
+/*
+ * Sweep the read or the write timing from the fewest total cycles upwards
+ * (address setup before data phase) while the other direction stays at
+ * "fixed". The first setting that passes LCD_CAL_ROUNDS rounds goes to
+ * "result" with the data phase margin added (see LCD_CAL_MARGIN).
+ */
+static uint8_t LCD_CalSweep(LCD_FSMCTiming *result, const LCD_FSMCTiming *fixed, uint8_t reads) {
+    LCD_FSMCTiming test;
+    uint16_t total, addset, datast, margin;
+    uint8_t round;
+    
+    for (total = 1; total <= LCD_FSMC_ADDSET_MAX + LCD_FSMC_DATAST_MAX; total++) {
+        for (addset = 0; addset <= LCD_FSMC_ADDSET_MAX && addset < total; addset++) {
+            datast = total - addset;
+            if (datast > LCD_FSMC_DATAST_MAX)
+                continue;
+            test.addset = addset;
+            test.datast = datast;
+            for (round = 0; round < LCD_CAL_ROUNDS &&
+                 LCD_CalVerify(reads ? &test : fixed, reads ? fixed : &test); round++);
+            if (round < LCD_CAL_ROUNDS)
+                continue;
+            
+            margin = (datast + (1 << LCD_CAL_MARGIN_SHIFT) - 1) >> LCD_CAL_MARGIN_SHIFT;
+            datast += margin > LCD_CAL_MARGIN ? margin : LCD_CAL_MARGIN;
+            result->addset = addset;
+            result->datast = datast > LCD_FSMC_DATAST_MAX ? LCD_FSMC_DATAST_MAX : datast;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Find the fastest FSMC timing the panel handles, writes first (checked
+ * with reads at the safe default) and then reads (with the tuned writes).
+ * Overwrites the top left of GRAM. Returns 0 and keeps the default timing
+ * if no setting is stable.
+ */
+uint8_t LCD_FSMCCalibrate(void) {
+    LCD_FSMCTiming read, write;
+    
+    LCD_WaitDMA();
+    if (!LCD_CalSweep(&write, &LCD_FSMCDefaultRead, 0) ||
+        !LCD_CalSweep(&read, &write, 1)) {
+        LCD_FSMCConfig();
+        return 0;
+    }
+    LCD_FSMCRead = read;
+    LCD_FSMCWrite = write;
+    LCD_FSMCSetTiming(&LCD_FSMCRead, &LCD_FSMCWrite);
+    return 1;
+}
+
+/*
+ * Power-on sequence: register, value and the minimum wait in ms after the
+ * write. Only oscillator start, sleep exit and the power supply setup need
+ * one; the bus is slow enough for everything else.
+ */
+typedef struct {
+    uint8_t  reg;
+    uint16_t value;
+    uint8_t  delay;
+} LCD_InitStep;
+
+static const LCD_InitStep LCD_InitSequence[] = {
+    {0x07, 0x0021,         0},
+    {0x00, 0x0001,         LCD_INIT_OSC_MS},
+    {0x07, 0x0023,         0},
+    {0x10, 0x0000,         LCD_INIT_SLEEP_OUT_MS},
+    {0x07, LCD_DISPLAY_ON, 0},
+    {0x11, LCD_ENTRY_MODE, 0},
+    {0x02, 0x0600,         0},
+    {0x12, 0x6CEB,         0},
+    {0x03, 0xA8A4,         0},
+    {0x0C, 0x0000,         0},
+    {0x0D, 0x080C,         0},
+    {0x0E, 0x2B00,         0},
+    {0x1E, 0x00B0,         LCD_INIT_POWER_MS},
+    {0x01, 0x2B3F,         0},    /* RGB */
+    {0x05, 0x0000,         0},
+    {0x06, 0x0000,         0},
+    {0x16, 0xEF1C,         0},
+    {0x17, 0x0103,         0},
+    {0x0B, 0x0000,         0},
+    {0x0F, 0x0000,         0},
+    {0x41, 0x0000,         0},
+    {0x42, 0x0000,         0},
+    {0x48, 0x0000,         0},
+    {0x49, 0x013F,         0},
+    {0x4A, 0x0000,         0},
+    {0x4B, 0x0000,         0},
+    {0x44, 0xEF00,         0},
+    {0x45, 0x0000,         0},
+    {0x46, 0x013F,         0},
+    {0x30, 0x0707,         0},
+    {0x31, 0x0204,         0},
+    {0x32, 0x0204,         0},
+    {0x33, 0x0502,         0},
+    {0x34, 0x0507,         0},
+    {0x35, 0x0204,         0},
+    {0x36, 0x0204,         0},
+    {0x37, 0x0502,         0},
+    {0x3A, 0x0302,         0},
+    {0x2F, 0x12BE,         0},
+    {0x3B, 0x0302,         0},
+    {0x23, 0x0000,         0},
+    {0x24, 0x0000,         0},
+    {0x25, 0x8000,         0},
+    {0x4F, 0x0000,         0},
+    {0x4E, 0x0000,         0},
+};
+
+/* Boot profile, see LCD_BootStart() */
+LCD_BootStage LCD_BootStages[LCD_BOOT_MAX_STAGES];
+uint8_t LCD_BootStageCount = 0;
+static uint32_t LCD_BootStartCycles = 0;
+
+/*
+ * Start the DWT cycle counter behind LCD_CYCLES(), which the boot profile,
+ * the benchmarks and the scheduler's run-time accounting read.
+ */
+void LCD_CyclesInit(void) {
+#ifndef LCD_SIMULATOR
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/*
+ * Start the boot profile: start the cycle counter and forget earlier
+ * stages. Call first thing in main().
+ */
+void LCD_BootStart(void) {
+    LCD_CyclesInit();
+    LCD_BootStartCycles = LCD_CYCLES();
+    LCD_BootStageCount = 0;
+}
+
+/* Record the end of stage "name" (a string literal) */
+void LCD_BootMark(const char *name) {
+    LCD_BootStage *stage;
+    
+    if (LCD_BootStageCount >= LCD_BOOT_MAX_STAGES)
+        return;
+    stage = &LCD_BootStages[LCD_BootStageCount++];
+    stage->name = name;
+    stage->cycles = LCD_CYCLES() - LCD_BootStartCycles;
+}
 
 /*
  * Reset and Initialize Display.
 */
 void Init_LCD(void) {
+    const LCD_InitStep *step;
+    const LCD_InitStep *end = LCD_InitSequence + sizeof(LCD_InitSequence) / sizeof(LCD_InitSequence[0]);
     
     LCD_CtrlLinesConfig();
-    Delay(3000);
     LCD_FSMCConfig();
-    Delay(3000);
+    LCD_DMAConfig();
     TIM_Config();
     LCD_BackLight(100);
+    LCD_BootMark("bus");
     
-    LCD_WriteReg(0x0007,0x0021);    Delay(50);
-    LCD_WriteReg(0x0000,0x0001);    Delay(50);
-    LCD_WriteReg(0x0007,0x0023);    Delay(50);
-    LCD_WriteReg(0x0010,0x0000);    Delay(90);
-    LCD_WriteReg(0x0007,0x0033);    Delay(50);
-    LCD_WriteReg(0x0011,0x6830);    Delay(50);
-    LCD_WriteReg(0x0002,0x0600);    Delay(50);
-    LCD_WriteReg(0x0012,0x6CEB);    Delay(50);
-    LCD_WriteReg(0x0003,0xA8A4);    Delay(50);
-    LCD_WriteReg(0x000C,0x0000);    Delay(50);
-    LCD_WriteReg(0x000D,0x080C);    Delay(50);
-    LCD_WriteReg(0x000E,0x2B00);    Delay(50);
-    LCD_WriteReg(0x001E,0x00B0);    Delay(50);
-    LCD_WriteReg(0x0001,0x2b3F);    Delay(50);  //RGB
-    LCD_WriteReg(0x0005,0x0000);    Delay(50);
-    LCD_WriteReg(0x0006,0x0000);    Delay(50);
-    LCD_WriteReg(0x0016,0xEF1C);    Delay(50);
-    LCD_WriteReg(0x0017,0x0103);    Delay(50);
-    LCD_WriteReg(0x000B,0x0000);    Delay(50);
-    LCD_WriteReg(0x000F,0x0000);    Delay(50);
-    LCD_WriteReg(0x0041,0x0000);    Delay(50);
-    LCD_WriteReg(0x0042,0x0000);    Delay(50);
-    LCD_WriteReg(0x0048,0x0000);    Delay(50);
-    LCD_WriteReg(0x0049,0x013F);    Delay(50);
-    LCD_WriteReg(0x004A,0x0000);    Delay(50);
-    LCD_WriteReg(0x004B,0x0000);    Delay(50);
-    LCD_WriteReg(0x0044,0xEF00);    Delay(50);
-    LCD_WriteReg(0x0045,0x0000);    Delay(50);
-    LCD_WriteReg(0x0046,0x013F);    Delay(50);
-    LCD_WriteReg(0x0030,0x0707);    Delay(50);
-    LCD_WriteReg(0x0031,0x0204);    Delay(50);
-    LCD_WriteReg(0x0032,0x0204);    Delay(50);
-    LCD_WriteReg(0x0033,0x0502);    Delay(50);
-    LCD_WriteReg(0x0034,0x0507);    Delay(50);
-    LCD_WriteReg(0x0035,0x0204);    Delay(50);
-    LCD_WriteReg(0x0036,0x0204);    Delay(50);
-    LCD_WriteReg(0x0037,0x0502);    Delay(50);
-    LCD_WriteReg(0x003A,0x0302);    Delay(50);
-    LCD_WriteReg(0x002F,0x12BE);    Delay(50);
-    LCD_WriteReg(0x003B,0x0302);    Delay(50);
-    LCD_WriteReg(0x0023,0x0000);    Delay(50);
-    LCD_WriteReg(0x0024,0x0000);    Delay(50);
-    LCD_WriteReg(0x0025,0x8000);    Delay(50);
-    LCD_WriteReg(0x004f,0x0000);    Delay(50);
-    LCD_WriteReg(0x004e,0x0000);    Delay(50);
+    /* Delay(n) ends on the n-th tick, up to a tick early, hence the +1 */
+    Delay(LCD_INIT_POWERUP_MS + 1);
+    LCD_BootMark("power up");
+    for (step = LCD_InitSequence; step < end; step++) {
+        LCD_WriteReg(step->reg, step->value);
+        if (step->delay)
+            Delay(step->delay + 1);
+    }
+    LCD_BootMark("registers");
     
+#if LCD_FSMC_AUTOTUNE
+    LCD_FSMCCalibrate();
+    LCD_BootMark("fsmc tuning");
+#endif
 }
 
 void LCD_WriteRAM_Prepare(void) {
-    LCD_REG = LCD_REG_34;
+    LCD_WRITE_INDEX(LCD_REG_34);
 }
 
 void LCD_WriteRAM(uint16_t RGB_Code) {
-    LCD_RAM = RGB_Code;
+    LCD_WRITE_DATA(RGB_Code);
 }
 
 void LCD_WriteReg(uint8_t LCD_Reg, uint16_t LCD_RegValue) {
-    LCD_REG = LCD_Reg;
-    LCD_RAM = LCD_RegValue;
+    /* A register write in the middle of a DMA burst would corrupt GRAM */
+    LCD_WaitDMA();
+    LCD_WRITE_INDEX(LCD_Reg);
+    LCD_WRITE_DATA(LCD_RegValue);
     
 }
 
+uint16_t LCD_ReadReg(uint8_t LCD_Reg) {
+    LCD_WaitDMA();
+    LCD_WRITE_INDEX(LCD_Reg);
+    return LCD_READ_DATA();
+}
+
+/*
+ * Read the GRAM pixel at the current cursor. The first read after R22h
+ * only latches the data and returns garbage.
+ */
+uint16_t LCD_ReadRAM(void) {
+    LCD_WaitDMA();
+    LCD_WRITE_INDEX(LCD_REG_34);
+    LCD_READ_DATA();
+    return LCD_READ_DATA();
+}
+
+uint16_t LCD_ReadPixel(uint16_t x, uint16_t y) {
+    LCD_SetCursor(y, LCD_PIXEL_WIDTH - 1 - x);
+    return LCD_ReadRAM();
+}
+
+/*
+ * Read the w*h screen rectangle at [x,y] into "buffer" row by row, in one
+ * window and one burst. The rectangle has to be on the screen. This is
+ * GRAM content, the hardware scroll offset is not applied.
+ */
+void LCD_ReadWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *buffer) {
+    uint32_t index;
+    
+    LCD_SetWindow(x, y, w, h);
+    LCD_READ_DATA();    /* dummy read after R22h */
+    for (index = (uint32_t)w * h; index != 0; index--)
+        *buffer++ = LCD_READ_DATA();
+}
+
 void LCD_SetCursor(uint16_t Xpos, uint16_t Ypos) {
     LCD_WriteReg(LCD_REG_78, Xpos);
     LCD_WriteReg(LCD_REG_79, Ypos);
     
 }
 
+/*
+ * Restrict GRAM writes to the screen rectangle [x,y,w,h], move the address
+ * counter to its top left pixel and start a GRAM write. The caller then
+ * sends exactly w*h pixels, row by row. The rectangle must be on screen.
+ */
+void LCD_SetWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    uint16_t x_end = x + w - 1;
+    uint16_t y_end = y + h - 1;
+    
+    /* Screen rows are GRAM X (HSA/HEA), screen columns are GRAM Y (VSA/VEA) */
+    LCD_WriteReg(LCD_REG_68, (y_end << 8) | y);
+    LCD_WriteReg(LCD_REG_69, LCD_PIXEL_WIDTH - 1 - x_end);
+    LCD_WriteReg(LCD_REG_70, LCD_PIXEL_WIDTH - 1 - x);
+    LCD_SetCursor(y, LCD_PIXEL_WIDTH - 1 - x);
+    LCD_WriteRAM_Prepare();
+}
+
+/*
+ * Fill a rectangle with one window setup and one burst of w*h pixels.
+ * The rectangle is clipped to the screen.
+ */
+void LCD_FillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    int32_t x_end = (int32_t)x + w;
+    int32_t y_end = (int32_t)y + h;
+    uint32_t index;
+    
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x_end > LCD_PIXEL_WIDTH) x_end = LCD_PIXEL_WIDTH;
+    if (y_end > LCD_PIXEL_HEIGHT) y_end = LCD_PIXEL_HEIGHT;
+    if (x_end <= x || y_end <= y)
+        return;
+    
+    w = x_end - x;
+    h = y_end - y;
+    LCD_SetWindow(x, y, w, h);
+    for(index = (uint32_t)w * h; index != 0; index--){
+        LCD_WRITE_DATA(color);
+    }
+}
+
 void LCD_Clear(uint16_t color) {
     uint32_t index = 0;
-    LCD_SetCursor(0x00, 0x00);
-    LCD_WriteRAM_Prepare();
+    LCD_SetWindow(0, 0, LCD_PIXEL_WIDTH, LCD_PIXEL_HEIGHT);
     for(index = 0; index <76800; index++){
-        LCD_RAM = color;
+        LCD_WRITE_DATA(color);
     }
 }
 
+/*
+ * Text.
+ *
+ * Glyphs are drawn as opaque TextColor on BackColor cells, asciisize / font
+ * height times the font size. Every glyph row is expanded straight into the
+ * GRAM burst of a window, nothing is plotted pixel by pixel.
+ */
+void LCD_SetFont(const LCD_Font *font) {
+    LCD_CurrentFont = font;
+}
+
+const LCD_Font *LCD_GetFont(void) {
+    return LCD_CurrentFont;
+}
+
+void LCD_SetTextColors(uint16_t text, uint16_t back) {
+    TextColor = text;
+    BackColor = back;
+}
+
+static uint8_t LCD_TextScale(void) {
+    uint8_t scale = asciisize / LCD_CurrentFont->height;
+    return scale ? scale : 1;
+}
+
+static const uint8_t *LCD_Glyph(const LCD_Font *font, char c) {
+    uint8_t code = (uint8_t)c;
+    
+    if (code < font->first || code > font->last)
+        code = font->first;     /* usually the space */
+    return font->data + (uint32_t)(code - font->first) * font->height * ((font->width + 7) / 8);
+}
+
+/*
+ * Send one glyph row of the burst, each pixel "scale" times.
+ */
+static void LCD_GlyphRow(const uint8_t *row, uint8_t width, uint8_t scale,
+                         uint16_t text, uint16_t back) {
+    uint8_t bits = 0;
+    uint8_t col, repeat;
+    uint16_t color;
+    
+    for (col = 0; col < width; col++) {
+        if ((col & 7) == 0)
+            bits = *row++;
+        color = (bits & 0x80) ? text : back;
+        bits <<= 1;
+        for (repeat = scale; repeat != 0; repeat--)
+            LCD_WRITE_DATA(color);
+    }
+}
+
+/*
+ * Draw one character with its top left corner at [x,y]: one window and one
+ * burst. Returns the x position of the next character.
+ */
+uint16_t LCD_DrawChar(int16_t x, int16_t y, char c) {
+    char text[2];
+    
+    text[0] = c;
+    text[1] = 0;
+    return LCD_DrawString(x, y, text);
+}
+
+/*
+ * Draw a string with one window for the whole line: each screen row of the
+ * window is the matching glyph row of every character in turn. Characters
+ * that do not fit on the screen are dropped. Returns the x position after
+ * the last character drawn.
+ */
+uint16_t LCD_DrawString(int16_t x, int16_t y, const char *text) {
+    const LCD_Font *font = LCD_CurrentFont;
+    uint8_t scale = LCD_TextScale();
+    uint16_t cell_w = font->width * scale;
+    uint16_t cell_h = font->height * scale;
+    uint8_t row_bytes = (font->width + 7) / 8;
+    uint16_t text_color = TextColor;
+    uint16_t back_color = BackColor;
+    const char *c;
+    uint16_t count, index, line;
+    uint8_t repeat;
+    
+    /* Skip characters left of the screen, keep those that fit */
+    while (x < 0 && *text) {
+        x += cell_w;
+        text++;
+    }
+    if (y < 0 || y + cell_h > LCD_PIXEL_HEIGHT || x >= LCD_PIXEL_WIDTH)
+        return x;
+    for (count = 0; text[count] && x + (count + 1) * cell_w <= LCD_PIXEL_WIDTH; count++);
+    if (count == 0)
+        return x;
+    
+    LCD_SetWindow(x, y, count * cell_w, cell_h);
+    for (line = 0; line < font->height; line++) {
+        for (repeat = scale; repeat != 0; repeat--) {
+            c = text;
+            for (index = 0; index < count; index++, c++) {
+                LCD_GlyphRow(LCD_Glyph(font, *c) + line * row_bytes, font->width, scale,
+                             text_color, back_color);
+            }
+        }
+    }
+    return x + count * cell_w;
+}
+
+/*
+ * Anti-aliased text.
+ *
+ * The 16 possible blends of TextColor over BackColor are computed once per
+ * color pair, so a pixel costs one table lookup like a 1bpp pixel costs one
+ * test.
+ */
+void LCD_SetFontAA(const LCD_FontAA *font) {
+    LCD_CurrentFontAA = font;
+}
+
+static void LCD_BuildAARamp(uint16_t text, uint16_t back) {
+    uint32_t tr = (text >> 11) & 0x1F, tg = (text >> 5) & 0x3F, tb = text & 0x1F;
+    uint32_t br = (back >> 11) & 0x1F, bg = (back >> 5) & 0x3F, bb = back & 0x1F;
+    uint8_t level;
+    
+    for (level = 0; level < 16; level++) {
+        LCD_AARamp[level] = (((tr * level + br * (15 - level) + 7) / 15) << 11) |
+                            (((tg * level + bg * (15 - level) + 7) / 15) << 5) |
+                             ((tb * level + bb * (15 - level) + 7) / 15);
+    }
+    LCD_AARampText = text;
+    LCD_AARampBack = back;
+    LCD_AARampValid = 1;
+}
+
+/*
+ * Same as LCD_DrawString() with the current anti-aliased font, drawn at its
+ * own size (asciisize is not used).
+ */
+uint16_t LCD_DrawStringAA(int16_t x, int16_t y, const char *text) {
+    const LCD_FontAA *font = LCD_CurrentFontAA;
+    uint8_t row_bytes = (font->width + 1) / 2;
+    uint32_t glyph_bytes = (uint32_t)row_bytes * font->height;
+    const uint16_t *ramp = LCD_AARamp;
+    const uint8_t *row;
+    uint16_t count, index, line;
+    uint8_t code, col, bits;
+    
+    if (!LCD_AARampValid || LCD_AARampText != TextColor || LCD_AARampBack != BackColor)
+        LCD_BuildAARamp(TextColor, BackColor);
+    
+    while (x < 0 && *text) {
+        x += font->width;
+        text++;
+    }
+    if (y < 0 || y + font->height > LCD_PIXEL_HEIGHT || x >= LCD_PIXEL_WIDTH)
+        return x;
+    for (count = 0; text[count] && x + (count + 1) * font->width <= LCD_PIXEL_WIDTH; count++);
+    if (count == 0)
+        return x;
+    
+    LCD_SetWindow(x, y, count * font->width, font->height);
+    for (line = 0; line < font->height; line++) {
+        for (index = 0; index < count; index++) {
+            code = (uint8_t)text[index];
+            if (code < font->first || code > font->last)
+                code = font->first;
+            row = font->data + (code - font->first) * glyph_bytes + line * row_bytes;
+            for (col = 0; col + 1 < font->width; col += 2) {
+                bits = *row++;
+                LCD_WRITE_DATA(ramp[bits >> 4]);
+                LCD_WRITE_DATA(ramp[bits & 0x0F]);
+            }
+            if (col < font->width)
+                LCD_WRITE_DATA(ramp[*row >> 4]);
+        }
+    }
+    return x + count * font->width;
+}
+
+/*
+ * Draw a line including both end points. Horizontal and vertical lines are
+ * one window and one burst. Other lines are drawn as Bresenham run slices:
+ * the pixels of a shallow line that share a row (of a steep line that share
+ * a column) go out as one short burst.
+ */
+void LCD_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int32_t dx = LCD_ABS((int32_t)x1 - x0);
+    int32_t dy = LCD_ABS((int32_t)y1 - y0);
+    int16_t sx = x0 < x1 ? 1 : -1;
+    int16_t sy = y0 < y1 ? 1 : -1;
+    int32_t err, step;
+    int16_t run;
+    
+    if (dy == 0) {
+        LCD_FillRect(x0 < x1 ? x0 : x1, y0, dx + 1, 1, color);
+        return;
+    }
+    if (dx == 0) {
+        LCD_FillRect(x0, y0 < y1 ? y0 : y1, 1, dy + 1, color);
+        return;
+    }
+    
+    if (dx >= dy) {
+        err = dx / 2;
+        run = x0;
+        for (step = 0; step < dx; step++) {
+            x0 += sx;
+            err -= dy;
+            if (err < 0) {
+                /* The row ends at the previous pixel */
+                LCD_FillRect(sx > 0 ? run : x0 + 1, y0, LCD_ABS(x0 - run), 1, color);
+                y0 += sy;
+                err += dx;
+                run = x0;
+            }
+        }
+        LCD_FillRect(sx > 0 ? run : x0, y0, LCD_ABS(x0 - run) + 1, 1, color);
+    }else{
+        err = dy / 2;
+        run = y0;
+        for (step = 0; step < dy; step++) {
+            y0 += sy;
+            err -= dx;
+            if (err < 0) {
+                LCD_FillRect(x0, sy > 0 ? run : y0 + 1, 1, LCD_ABS(y0 - run), color);
+                x0 += sx;
+                err += dy;
+                run = y0;
+            }
+        }
+        LCD_FillRect(x0, sy > 0 ? run : y0, 1, LCD_ABS(y0 - run) + 1, color);
+    }
+}
+
+/*
+ * First pixel at or right of the 16.16 position x, clamped to the screen
+ * so far off edges still fit LCD_FillRect().
+ */
+static int32_t LCD_PolyScreenX(int64_t x) {
+    if (x < 0)
+        return 0;
+    if (x > (int64_t)LCD_PIXEL_WIDTH << 16)
+        return LCD_PIXEL_WIDTH;
+    return (int32_t)((x + 0xFFFF) >> 16);
+}
+
+/*
+ * Fill a polygon (even-odd rule) with a scanline filler: the edges are
+ * sorted by their top scanline, an active edge list is kept sorted by x and
+ * each span between a pair of active edges is one windowed burst. Pixels
+ * are filled when their center is inside. At most MAX_POLY_CORNERS corners.
+ */
+void LCD_FillPolygon(const Point *Points, uint16_t PointCount, uint16_t color) {
+    LCD_PolyEdge *edge;
+    LCD_PolyEdge *active;
+    LCD_PolyEdge temp;
+    uint16_t index, next, edges = 0, active_count = 0, pending = 0;
+    int32_t x0, y0, x1, y1, y, y_end, span_start, span_end;
+    int16_t slot;
+    
+    if (PointCount < 3 || PointCount > MAX_POLY_CORNERS)
+        return;
+    
+    /* Edge table, horizontal edges never cross a scanline center */
+    for (index = 0; index < PointCount; index++) {
+        next = (index + 1 == PointCount) ? 0 : index + 1;
+        x0 = POLY_X(index);
+        y0 = POLY_Y(index);
+        x1 = POLY_X(next);
+        y1 = POLY_Y(next);
+        if (y0 == y1)
+            continue;
+        if (y0 > y1) {
+            x0 = POLY_X(next);
+            y0 = POLY_Y(next);
+            x1 = POLY_X(index);
+            y1 = POLY_Y(index);
+        }
+        edge = &LCD_PolyEdges[edges];
+        edge->dxdy = (int64_t)(x1 - x0) * 65536 / (y1 - y0);
+        /* Half a pixel to the left: rounding up gives the first center inside */
+        edge->x = (int64_t)x0 * 65536 - 32768 + edge->dxdy / 2;
+        edge->y_top = y0;
+        edge->y_bottom = y1;
+        
+        /* Insertion sort by top scanline */
+        for (slot = edges; slot > 0 && LCD_PolyEdges[slot - 1].y_top > y0; slot--) {
+            temp = LCD_PolyEdges[slot];
+            LCD_PolyEdges[slot] = LCD_PolyEdges[slot - 1];
+            LCD_PolyEdges[slot - 1] = temp;
+        }
+        edges++;
+    }
+    if (edges == 0)
+        return;
+    
+    y = LCD_PolyEdges[0].y_top;
+    y_end = y;
+    for (index = 0; index < edges; index++) {
+        if (LCD_PolyEdges[index].y_bottom > y_end)
+            y_end = LCD_PolyEdges[index].y_bottom;
+    }
+    if (y < 0)
+        y = 0;
+    if (y_end > LCD_PIXEL_HEIGHT)
+        y_end = LCD_PIXEL_HEIGHT;
+    
+    for (; y < y_end; y++) {
+        /* Add the edges starting on this scanline, skipping clipped rows */
+        while (pending < edges && LCD_PolyEdges[pending].y_top <= y) {
+            edge = &LCD_PolyEdges[pending++];
+            if (edge->y_top < y)
+                edge->x += edge->dxdy * (y - edge->y_top);
+            LCD_PolyActive[active_count++] = edge;
+        }
+        
+        /* Drop finished edges */
+        for (index = 0; index < active_count; ) {
+            if (LCD_PolyActive[index]->y_bottom <= y)
+                LCD_PolyActive[index] = LCD_PolyActive[--active_count];
+            else
+                index++;
+        }
+        
+        /* The list stays almost sorted between scanlines */
+        for (index = 1; index < active_count; index++) {
+            active = LCD_PolyActive[index];
+            for (slot = index; slot > 0 && LCD_PolyActive[slot - 1]->x > active->x; slot--)
+                LCD_PolyActive[slot] = LCD_PolyActive[slot - 1];
+            LCD_PolyActive[slot] = active;
+        }
+        
+        for (index = 0; index + 1 < active_count; index += 2) {
+            /* First pixel inside and first pixel past the span */
+            span_start = LCD_PolyScreenX(LCD_PolyActive[index]->x);
+            span_end = LCD_PolyScreenX(LCD_PolyActive[index + 1]->x);
+            if (span_end > span_start)
+                LCD_FillRect(span_start, y, span_end - span_start, 1, color);
+        }
+        
+        for (index = 0; index < active_count; index++)
+            LCD_PolyActive[index]->x += LCD_PolyActive[index]->dxdy;
+    }
+}
+
+/*
+ * Ellipses and circles, midpoint algorithm.
+ *
+ * One quadrant is walked (x growing from 0, y shrinking from ry) and
+ * mirrored. The outline collects pixels that share a row or a column into
+ * runs, each of the four mirrored runs is one burst. The filled version
+ * sends one span per scanline.
+ */
+static void LCD_ArcFlush(int16_t xc, int16_t yc, LCD_ArcRun *run, uint16_t color) {
+    uint16_t w = run->x1 - run->x0 + 1;
+    uint16_t h = run->y1 - run->y0 + 1;
+    
+    if (!run->used)
+        return;
+    run->used = 0;
+    
+    /* Runs touching an axis are merged with their mirror image */
+    if (run->x0 == 0 && run->y0 == 0) {
+        LCD_FillRect(xc - run->x1, yc - run->y1, 2 * w - 1, 2 * h - 1, color);
+    }else if (run->x0 == 0) {
+        LCD_FillRect(xc - run->x1, yc - run->y1, 2 * w - 1, h, color);
+        LCD_FillRect(xc - run->x1, yc + run->y0, 2 * w - 1, h, color);
+    }else if (run->y0 == 0) {
+        LCD_FillRect(xc - run->x1, yc - run->y1, w, 2 * h - 1, color);
+        LCD_FillRect(xc + run->x0, yc - run->y1, w, 2 * h - 1, color);
+    }else{
+        LCD_FillRect(xc + run->x0, yc - run->y1, w, h, color);
+        LCD_FillRect(xc - run->x1, yc - run->y1, w, h, color);
+        LCD_FillRect(xc + run->x0, yc + run->y0, w, h, color);
+        LCD_FillRect(xc - run->x1, yc + run->y0, w, h, color);
+    }
+}
+
+static void LCD_ArcAdd(int16_t xc, int16_t yc, LCD_ArcRun *run, int32_t x, int32_t y, uint16_t color) {
+    /* The walk goes right and down, a run grows along one axis only */
+    if (run->used) {
+        if (y == run->y0 && run->y0 == run->y1 && x == run->x1 + 1) {
+            run->x1 = x;
+            return;
+        }
+        if (x == run->x0 && run->x0 == run->x1 && y == run->y0 - 1) {
+            run->y0 = y;
+            return;
+        }
+        LCD_ArcFlush(xc, yc, run, color);
+    }
+    run->x0 = run->x1 = x;
+    run->y0 = run->y1 = y;
+    run->used = 1;
+}
+
+static void LCD_EllipseSpan(int16_t xc, int16_t yc, int32_t x, int32_t y, uint16_t color) {
+    LCD_FillRect(xc - x, yc - y, 2 * x + 1, 1, color);
+    if (y != 0)
+        LCD_FillRect(xc - x, yc + y, 2 * x + 1, 1, color);
+}
+
+static void LCD_Ellipse(int16_t xc, int16_t yc, uint16_t rx, uint16_t ry, uint8_t filled, uint16_t color) {
+    int64_t rx2 = (int64_t)rx * rx;
+    int64_t ry2 = (int64_t)ry * ry;
+    int64_t dx = 0;
+    int64_t dy = 2 * rx2 * ry;
+    int64_t d;
+    int32_t x = 0, y = ry;
+    LCD_ArcRun run;
+    
+    if (rx == 0 || ry == 0) {
+        LCD_FillRect(xc - rx, yc - ry, 2 * rx + 1, 2 * ry + 1, color);
+        return;
+    }
+    run.used = 0;
+    
+    /* Region 1: slope above -1, x steps every time (decision values * 4) */
+    d = 4 * ry2 - 4 * rx2 * ry + rx2;
+    while (dx < dy) {
+        if (filled) {
+            if (d >= 0)
+                LCD_EllipseSpan(xc, yc, x, y, color);   /* last pixel of this row */
+        }else{
+            LCD_ArcAdd(xc, yc, &run, x, y, color);
+        }
+        x++;
+        dx += 2 * ry2;
+        if (d < 0) {
+            d += 4 * (dx + ry2);
+        }else{
+            y--;
+            dy -= 2 * rx2;
+            d += 4 * (dx - dy + ry2);
+        }
+    }
+    
+    /* Region 2: y steps every time */
+    d = ry2 * (2 * x + 1) * (2 * x + 1) + 4 * rx2 * (y - 1) * (y - 1) - 4 * rx2 * ry2;
+    while (y >= 0) {
+        if (filled)
+            LCD_EllipseSpan(xc, yc, x, y, color);
+        else
+            LCD_ArcAdd(xc, yc, &run, x, y, color);
+        y--;
+        dy -= 2 * rx2;
+        if (d > 0) {
+            d += 4 * (rx2 - dy);
+        }else{
+            x++;
+            dx += 2 * ry2;
+            d += 4 * (dx - dy + rx2);
+        }
+    }
+    LCD_ArcFlush(xc, yc, &run, color);
+}
+
+void LCD_DrawEllipse(int16_t xc, int16_t yc, uint16_t rx, uint16_t ry, uint16_t color) {
+    LCD_Ellipse(xc, yc, rx, ry, 0, color);
+}
+
+void LCD_FillEllipse(int16_t xc, int16_t yc, uint16_t rx, uint16_t ry, uint16_t color) {
+    LCD_Ellipse(xc, yc, rx, ry, 1, color);
+}
+
+void LCD_DrawCircle(int16_t xc, int16_t yc, uint16_t r, uint16_t color) {
+    LCD_Ellipse(xc, yc, r, r, 0, color);
+}
+
+void LCD_FillCircle(int16_t xc, int16_t yc, uint16_t r, uint16_t color) {
+    LCD_Ellipse(xc, yc, r, r, 1, color);
+}
+
+/*
+ * Hardware scrolling.
+ *
+ * The gate lines run along the long side of the panel, so the SSD1289
+ * "vertical" scroll moves the picture horizontally on this landscape
+ * screen. One gate line is one screen column.
+ *
+ * The scroll region is driven as its own screen (R48h-R4Bh) with its own
+ * scroll amount (R41h/R42h). A region narrower than the screen uses the
+ * split screen mode: screen 1 shows the fixed columns, screen 2 the
+ * scrolling ones, so the fixed part has to be a single band at the left
+ * or right edge (a legend next to a strip chart, for instance).
+ */
+static void LCD_WriteScrollRegisters(void) {
+    uint16_t gram_start = LCD_PIXEL_WIDTH - LCD_ScrollX0 - LCD_ScrollWidth;
+    uint16_t gram_end = LCD_PIXEL_WIDTH - 1 - LCD_ScrollX0;
+    /* Content moves to the left by LCD_ScrollLines columns */
+    uint16_t amount = (LCD_ScrollWidth - LCD_ScrollLines) % LCD_ScrollWidth;
+    
+    if (LCD_ScrollWidth == LCD_PIXEL_WIDTH) {
+        LCD_WriteReg(LCD_REG_72, 0x0000);
+        LCD_WriteReg(LCD_REG_73, LCD_PIXEL_WIDTH - 1);
+        LCD_WriteReg(LCD_REG_65, amount);
+        LCD_WriteReg(LCD_REG_7, LCD_DISPLAY_ON | LCD_DISPLAY_VLE1);
+    }else{
+        /* Fixed band on the other side of the region */
+        if (gram_start == 0) {
+            LCD_WriteReg(LCD_REG_72, gram_end + 1);
+            LCD_WriteReg(LCD_REG_73, LCD_PIXEL_WIDTH - 1);
+        }else{
+            LCD_WriteReg(LCD_REG_72, 0x0000);
+            LCD_WriteReg(LCD_REG_73, gram_start - 1);
+        }
+        LCD_WriteReg(LCD_REG_74, gram_start);
+        LCD_WriteReg(LCD_REG_75, gram_end);
+        LCD_WriteReg(LCD_REG_65, 0x0000);
+        LCD_WriteReg(LCD_REG_66, amount);
+        LCD_WriteReg(LCD_REG_7, LCD_DISPLAY_ON | LCD_DISPLAY_SPT | LCD_DISPLAY_VLE2);
+    }
+}
+
+/*
+ * Limit hardware scrolling to the screen columns [x, x+w). Returns 0 if the
+ * region leaves fixed columns on both sides. Resets the scroll position.
+ */
+uint8_t LCD_SetScrollRegion(uint16_t x, uint16_t w) {
+    if (w == 0 || x + w > LCD_PIXEL_WIDTH)
+        return 0;
+    if (x != 0 && x + w != LCD_PIXEL_WIDTH)
+        return 0;
+    
+    LCD_ScrollX0 = x;
+    LCD_ScrollWidth = w;
+    LCD_ScrollLines = 0;
+    LCD_WriteScrollRegisters();
+    return 1;
+}
+
+/*
+ * Move the picture in the scroll region "lines" columns to the left (wrapping
+ * around), without touching GRAM. Only the columns that come in on the right
+ * have to be redrawn, see LCD_ScrollX().
+ */
+void LCD_ScrollTo(uint16_t lines) {
+    LCD_ScrollLines = lines % LCD_ScrollWidth;
+    LCD_WriteScrollRegisters();
+}
+
+/*
+ * Drawing column that is shown at screen column "x" with the current scroll
+ * position. Columns outside the scroll region are not moved.
+ */
+uint16_t LCD_ScrollX(uint16_t x) {
+    if (x < LCD_ScrollX0 || x >= LCD_ScrollX0 + LCD_ScrollWidth)
+        return x;
+    return LCD_ScrollX0 + (x - LCD_ScrollX0 + LCD_ScrollLines) % LCD_ScrollWidth;
+}
+
+/*
+ * Enable the DMA2 clock and the transfer complete interrupt used to chain
+ * chunks of a long transfer.
+ */
+void LCD_DMAConfig(void) {
+    NVIC_InitTypeDef NVIC_InitStructure;
+    
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+    DMA_DeInit(LCD_DMA_STREAM);
+    
+    NVIC_InitStructure.NVIC_IRQChannel = LCD_DMA_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+static void LCD_DMAStartChunk(void) {
+    uint32_t chunk = LCD_DMARemaining;
+    
+    if (chunk > LCD_DMA_MAX_CHUNK)
+        chunk = LCD_DMA_MAX_CHUNK;
+    LCD_DMARemaining -= chunk;
+    
+    LCD_DMA_STREAM->PAR = (uintptr_t)LCD_DMASource;
+    if (LCD_DMASourceInc)
+        LCD_DMASource += chunk;
+    DMA_SetCurrDataCounter(LCD_DMA_STREAM, (uint16_t)chunk);
+    DMA_Cmd(LCD_DMA_STREAM, ENABLE);
+}
+
+/*
+ * Start a transfer of "rows" runs of "length" pixels into the GRAM data
+ * address. With "source_inc" set the source advances by "stride" pixels
+ * from one run to the next, otherwise the same halfword is sent every time.
+ */
+static void LCD_DMAStart(const uint16_t *source, uint8_t source_inc, uint32_t length,
+                         uint16_t rows, uint32_t stride, LCD_DMACallback callback) {
+    DMA_InitTypeDef DMA_InitStructure;
+    
+    if (length == 0 || rows == 0) {
+        if (callback)
+            callback();
+        return;
+    }
+    
+    LCD_DMASource = source;
+    LCD_DMARowStart = source;
+    LCD_DMASourceInc = source_inc;
+    LCD_DMARemaining = length;
+    LCD_DMARowLength = length;
+    LCD_DMARows = rows - 1;
+    LCD_DMAStride = stride;
+    LCD_DMADone = callback;
+    LCD_DMAActive = 1;
+    
+    /* In memory-to-memory mode the "peripheral" port is the source */
+    DMA_InitStructure.DMA_Channel = LCD_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uintptr_t)source;
+    DMA_InitStructure.DMA_Memory0BaseAddr = (uintptr_t)&LCD_RAM;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToMemory;
+    DMA_InitStructure.DMA_BufferSize = 1;
+    DMA_InitStructure.DMA_PeripheralInc = source_inc ? DMA_PeripheralInc_Enable : DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Disable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+    DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;   /* direct mode is not allowed for M2M */
+    DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+    DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+    DMA_Init(LCD_DMA_STREAM, &DMA_InitStructure);
+    
+    DMA_ClearITPendingBit(LCD_DMA_STREAM, LCD_DMA_IT_TC | LCD_DMA_IT_TE);
+    DMA_ITConfig(LCD_DMA_STREAM, DMA_IT_TC | DMA_IT_TE, ENABLE);
+    LCD_DMAStartChunk();
+}
+
+/*
+ * Write "count" pixels of a constant color to GRAM starting at the current
+ * address. The caller has to set the window (or cursor) and issue
+ * LCD_WriteRAM_Prepare() first. Returns immediately, "callback" (may be 0)
+ * runs from the DMA interrupt once the last pixel has been written.
+ */
+void LCD_FillDMA(uint16_t color, uint32_t count, LCD_DMACallback callback) {
+    LCD_WaitDMA();
+    LCD_DMAColor = color;
+    LCD_DMAStart((const uint16_t *)&LCD_DMAColor, 0, count, 1, 0, callback);
+}
+
+/*
+ * Same as LCD_FillDMA() but streams "count" pixels from a buffer in flash
+ * or SRAM (not CCM RAM, the DMA cannot reach it).
+ */
+void LCD_WriteDMA(const uint16_t *data, uint32_t count, LCD_DMACallback callback) {
+    LCD_WaitDMA();
+    LCD_DMAStart(data, 1, count, 1, 0, callback);
+}
+
+/*
+ * Blit a w*h RGB565 image to the screen at [x,y] with DMA. "stride" is the
+ * width of the source image in pixels, so a sub-rectangle of a larger image
+ * is drawn by pointing "bitmap" at its first pixel; its rows are chained one
+ * DMA transfer each from the interrupt. The image is clipped to the screen.
+ * Returns immediately, "callback" (may be 0) runs when the blit is done.
+ */
+void LCD_DrawBitmapAsync(int16_t x, int16_t y, uint16_t w, uint16_t h,
+                         const uint16_t *bitmap, uint16_t stride, LCD_DMACallback callback) {
+    int32_t x_end = (int32_t)x + w;
+    int32_t y_end = (int32_t)y + h;
+    
+    if (x < 0) { bitmap -= x; x = 0; }
+    if (y < 0) { bitmap -= (int32_t)y * stride; y = 0; }
+    if (x_end > LCD_PIXEL_WIDTH) x_end = LCD_PIXEL_WIDTH;
+    if (y_end > LCD_PIXEL_HEIGHT) y_end = LCD_PIXEL_HEIGHT;
+    if (x_end <= x || y_end <= y) {
+        if (callback)
+            callback();
+        return;
+    }
+    w = x_end - x;
+    h = y_end - y;
+    
+    LCD_SetWindow(x, y, w, h);
+    if (stride == w)
+        LCD_DMAStart(bitmap, 1, (uint32_t)w * h, 1, 0, callback);
+    else
+        LCD_DMAStart(bitmap, 1, w, h, stride, callback);
+}
+
+/*
+ * Blocking version of LCD_DrawBitmapAsync() for a contiguous w*h image.
+ */
+void LCD_DrawBitmap(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap) {
+    LCD_DrawBitmapAsync(x, y, w, h, bitmap, w, 0);
+    LCD_WaitDMA();
+}
+
+/*
+ * Clear the whole screen with DMA. Returns immediately, the CPU is free
+ * until "callback" is called from the DMA interrupt.
+ */
+void LCD_ClearAsync(uint16_t color, LCD_DMACallback callback) {
+    LCD_SetWindow(0, 0, LCD_PIXEL_WIDTH, LCD_PIXEL_HEIGHT);
+    LCD_FillDMA(color, (uint32_t)LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT, callback);
+}
+
+/*
+ * Blocking version of LCD_ClearAsync().
+ */
+void LCD_ClearDMA(uint16_t color) {
+    LCD_ClearAsync(color, 0);
+    LCD_WaitDMA();
+}
+
+uint8_t LCD_DMABusy(void) {
+    return LCD_DMAActive;
+}
+
+void LCD_WaitDMA(void) {
+    while (LCD_DMAActive);
+}
+
+/*
+ * Called from DMA2_Stream0_IRQHandler. Starts the next chunk or finishes the
+ * transfer and runs the completion callback.
+ */
+void LCD_DMA_IRQHandler(void) {
+    LCD_DMACallback callback;
+    
+    if (DMA_GetITStatus(LCD_DMA_STREAM, LCD_DMA_IT_TE) != RESET) {
+        DMA_ClearITPendingBit(LCD_DMA_STREAM, LCD_DMA_IT_TE);
+        DMA_Cmd(LCD_DMA_STREAM, DISABLE);
+        LCD_DMARemaining = 0;
+        LCD_DMARows = 0;
+    }else if (DMA_GetITStatus(LCD_DMA_STREAM, LCD_DMA_IT_TC) != RESET) {
+        DMA_ClearITPendingBit(LCD_DMA_STREAM, LCD_DMA_IT_TC);
+        if (LCD_DMARemaining != 0) {
+            LCD_DMAStartChunk();
+            return;
+        }
+        if (LCD_DMARows != 0) {
+            LCD_DMARows--;
+            LCD_DMARowStart += LCD_DMAStride;
+            LCD_DMASource = LCD_DMARowStart;
+            LCD_DMARemaining = LCD_DMARowLength;
+            LCD_DMAStartChunk();
+            return;
+        }
+    }else{
+        return;
+    }
+    
+    callback = LCD_DMADone;
+    LCD_DMADone = 0;
+    LCD_DMAActive = 0;
+    if (callback)
+        callback();
+}
+
+#ifndef LCD_SIMULATOR
 void LCD_BackLight(int procentai) {
     if (procentai>100)
     {procentai=100;}
@@ -253,4 +1302,5 @@ void LCD_BackLight(int procentai) {
     TIM_OCInitStructure.TIM_Pulse = Channel3Pulse;
     TIM_OC3Init(TIM1, &TIM_OCInitStructure);
 }
+#endif /* LCD_SIMULATOR */
 
@@ -48,10 +48,23 @@
  *       |                                       |
  *       -----------------------------------------
  *   [239,319]                               [239,0]
+ *
+ * The drawing functions (LCD_SetWindow, LCD_FillRect, ...) use screen
+ * coordinates instead: x = 0..LCD_PIXEL_WIDTH-1 from left to right and
+ * y = 0..LCD_PIXEL_HEIGHT-1 from top to bottom, so screen [x,y] is GRAM
+ * [y,319-x]. The entry mode makes GRAM writes inside a window advance left
+ * to right and then top to bottom on the screen.
  */
 
+#ifndef __SSD1289_H
+#define __SSD1289_H
+
+#ifdef LCD_SIMULATOR
+#include "lcd_sim.h"        /* host build, see sim/ */
+#else
 #include "stm32f4xx.h"
 #include "stm32f4xx_it.h"
+#endif
 
 
 
@@ -67,6 +80,28 @@
 #define LCD_BASE            ((uint32_t) (0x60000000 | 0x0001FFFE))
 #define LCD                 ((LCD_TypeDef *) LCD_BASE)
 
+/* A16 drives RS: index register at A16 = 0, data (GRAM) at A16 = 1 */
+#define LCD_REG      (*((volatile unsigned short *) 0x60000000))
+#define LCD_RAM      (*((volatile unsigned short *) 0x60020000))
+
+/* Bus accessors, the host simulator decodes them in software */
+#ifdef LCD_SIMULATOR
+#define LCD_WRITE_INDEX(Reg)     LCD_SimWriteIndex(Reg)
+#define LCD_WRITE_DATA(Data)     LCD_SimWriteData(Data)
+#define LCD_READ_DATA()          LCD_SimReadData()
+#else
+#define LCD_WRITE_INDEX(Reg)     (LCD_REG = (Reg))
+#define LCD_WRITE_DATA(Data)     (LCD_RAM = (Data))
+#define LCD_READ_DATA()          (LCD_RAM)
+#endif
+
+/* Free running HCLK cycle counter, DWT on the board */
+#ifdef LCD_SIMULATOR
+#define LCD_CYCLES()             LCD_SimCycles()
+#else
+#define LCD_CYCLES()             (DWT->CYCCNT)
+#endif
+
 #define GDDRAM_PREPARE      0x0022  /* Graphic Display Data RAM Register. */
 
 #define LCD_REG_0             0x00
@@ -195,11 +230,189 @@
 #define LCD_PIXEL_WIDTH          0x0140
 #define LCD_PIXEL_HEIGHT         0x00F0
 
+/*
+ * Default FSMC timing in HCLK cycles (168 MHz), extended mode A. Reads get
+ * a much longer RD pulse than writes, the SSD1289 needs it. These are the
+ * known good settings used during init; LCD_FSMCCalibrate() replaces them
+ * with the fastest ones the panel passes unless LCD_FSMC_AUTOTUNE is 0.
+ */
+#define LCD_FSMC_ADDSET          0
+#define LCD_FSMC_DATAST          4
+#define LCD_FSMC_READ_ADDSET     15
+#define LCD_FSMC_READ_DATAST     60
+#define LCD_FSMC_ADDSET_MAX      15
+#define LCD_FSMC_DATAST_MAX      255
+
+#ifndef LCD_FSMC_AUTOTUNE
+#define LCD_FSMC_AUTOTUNE        1
+#endif
+
+/*
+ * Calibration: pixels per pattern, passes per setting. The passing data
+ * phase gets 1/2^LCD_CAL_MARGIN_SHIFT of itself on top, at least
+ * LCD_CAL_MARGIN cycles, for temperature and supply drift.
+ */
+#define LCD_CAL_PIXELS           64
+#define LCD_CAL_ROUNDS           4
+#define LCD_CAL_MARGIN           2
+#define LCD_CAL_MARGIN_SHIFT     2
+
+/* Display control (R07h): display on, plus scroll and split screen enables */
+#define LCD_DISPLAY_ON           0x0033
+#define LCD_DISPLAY_SPT          0x0100
+#define LCD_DISPLAY_VLE1         0x0200
+#define LCD_DISPLAY_VLE2         0x0400
+
+/* 65k colors, Y address decrement, X address increment, Y address first */
+#define LCD_ENTRY_MODE           0x6818
+
+/*
+ * Power-on waits in ms (SysTick ticks). The controller's RESET comes from
+ * the board, so it only needs to be out of reset before the first access;
+ * the oscillator, sleep exit and power supply waits are in the init table.
+ */
+#define LCD_INIT_POWERUP_MS      10
+#define LCD_INIT_OSC_MS          10
+#define LCD_INIT_SLEEP_OUT_MS    30
+#define LCD_INIT_POWER_MS        40
+
+/* Boot profile: stages recorded by LCD_BootMark() */
+#define LCD_BOOT_MAX_STAGES      12
+
 #define ASSEMBLE_RGB(R ,G, B)    ((((R)& 0xF8) << 8) | (((G) & 0xFC) << 3) | (((B) & 0xF8) >> 3))
 
-void TimingDelay_Decrement(void);
+/* Not ABS(), main.h has its own */
+#define LCD_ABS(X)               ((X) > 0 ? (X) : -(X))
+
+/*
+ * DMA2 is the only controller that can do memory-to-memory transfers, so it
+ * is used to stream pixels into the FSMC data address. NDTR is 16 bit wide,
+ * longer transfers are chained in LCD_DMA_MAX_CHUNK pieces from the ISR.
+ */
+#define LCD_DMA_STREAM           DMA2_Stream0
+#define LCD_DMA_CHANNEL          DMA_Channel_0
+#define LCD_DMA_IRQn             DMA2_Stream0_IRQn
+#define LCD_DMA_IT_TC            DMA_IT_TCIF0
+#define LCD_DMA_IT_TE            DMA_IT_TEIF0
+#define LCD_DMA_MAX_CHUNK        0xFFFF
+
+typedef void (*LCD_DMACallback)(void);
+
+/*
+ * Fixed pitch 1bpp font: glyph rows packed MSB first, (width + 7) / 8 bytes
+ * per row, "height" rows per glyph, characters first..last.
+ */
+typedef struct {
+    uint8_t        width;
+    uint8_t        height;
+    uint8_t        first;
+    uint8_t        last;
+    const uint8_t *data;
+} LCD_Font;
+
+/*
+ * Anti-aliased font: 4bpp coverage per pixel, two pixels per byte (left one
+ * in the high nibble), (width + 1) / 2 bytes per row.
+ */
+typedef struct {
+    uint8_t        width;
+    uint8_t        height;
+    uint8_t        first;
+    uint8_t        last;
+    const uint8_t *data;
+} LCD_FontAA;
+
+/* FSMC access timing for one direction, in HCLK cycles */
+typedef struct {
+    uint8_t addset;
+    uint8_t datast;
+} LCD_FSMCTiming;
+
+extern const LCD_Font LCD_Font6x8;
+extern const LCD_FontAA LCD_FontAA12x16;
+extern __IO uint16_t TextColor;
+extern __IO uint16_t BackColor;
+extern __IO uint16_t asciisize;
+extern LCD_FSMCTiming LCD_FSMCRead;
+extern LCD_FSMCTiming LCD_FSMCWrite;
+
+typedef struct {
+    int16_t X;
+    int16_t Y;
+} Point, * pPoint;
+
+/* Rectangle in screen coordinates */
+typedef struct {
+    int16_t  x;
+    int16_t  y;
+    uint16_t w;
+    uint16_t h;
+} LCD_Rect;
+
+/* End of a startup stage, in HCLK cycles since LCD_BootStart() */
+typedef struct {
+    const char *name;
+    uint32_t    cycles;
+} LCD_BootStage;
+
+extern LCD_BootStage LCD_BootStages[LCD_BOOT_MAX_STAGES];
+extern uint8_t LCD_BootStageCount;
+
 void Delay_ms(__IO uint32_t nTime);
 void Init_SysTick(void);
 void init_FSMC(void);
 void init_GPIO(void);
 
+void Init_LCD(void);
+void LCD_CyclesInit(void);
+void LCD_BootStart(void);
+void LCD_BootMark(const char *name);
+void LCD_FSMCSetTiming(const LCD_FSMCTiming *read, const LCD_FSMCTiming *write);
+void LCD_FSMCConfig(void);
+uint8_t LCD_FSMCCalibrate(void);
+void LCD_WriteReg(uint8_t LCD_Reg, uint16_t LCD_RegValue);
+void LCD_WriteRAM_Prepare(void);
+void LCD_WriteRAM(uint16_t RGB_Code);
+uint16_t LCD_ReadReg(uint8_t LCD_Reg);
+uint16_t LCD_ReadRAM(void);
+uint16_t LCD_ReadPixel(uint16_t x, uint16_t y);
+void LCD_ReadWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *buffer);
+void LCD_SetCursor(uint16_t Xpos, uint16_t Ypos);
+void LCD_Clear(uint16_t color);
+void LCD_SetWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void LCD_FillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+void LCD_BackLight(int procentai);
+
+void LCD_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+void LCD_FillPolygon(const Point *Points, uint16_t PointCount, uint16_t color);
+void LCD_DrawEllipse(int16_t xc, int16_t yc, uint16_t rx, uint16_t ry, uint16_t color);
+void LCD_FillEllipse(int16_t xc, int16_t yc, uint16_t rx, uint16_t ry, uint16_t color);
+void LCD_DrawCircle(int16_t xc, int16_t yc, uint16_t r, uint16_t color);
+void LCD_FillCircle(int16_t xc, int16_t yc, uint16_t r, uint16_t color);
+
+void LCD_SetFont(const LCD_Font *font);
+const LCD_Font *LCD_GetFont(void);
+void LCD_SetTextColors(uint16_t text, uint16_t back);
+uint16_t LCD_DrawChar(int16_t x, int16_t y, char c);
+uint16_t LCD_DrawString(int16_t x, int16_t y, const char *text);
+void LCD_SetFontAA(const LCD_FontAA *font);
+uint16_t LCD_DrawStringAA(int16_t x, int16_t y, const char *text);
+
+uint8_t LCD_SetScrollRegion(uint16_t x, uint16_t w);
+void LCD_ScrollTo(uint16_t lines);
+uint16_t LCD_ScrollX(uint16_t x);
+
+void LCD_DMAConfig(void);
+void LCD_FillDMA(uint16_t color, uint32_t count, LCD_DMACallback callback);
+void LCD_WriteDMA(const uint16_t *data, uint32_t count, LCD_DMACallback callback);
+void LCD_DrawBitmapAsync(int16_t x, int16_t y, uint16_t w, uint16_t h,
+                         const uint16_t *bitmap, uint16_t stride, LCD_DMACallback callback);
+void LCD_DrawBitmap(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap);
+void LCD_ClearAsync(uint16_t color, LCD_DMACallback callback);
+void LCD_ClearDMA(uint16_t color);
+uint8_t LCD_DMABusy(void);
+void LCD_WaitDMA(void);
+void LCD_DMA_IRQHandler(void);
+
+#endif /* __SSD1289_H */
+
@@ -0,0 +1,93 @@
+/*
+ * Drawing commands for the display's USB interface, see lcd_client.h.
+ */
+
+#include <string.h>
+#include "lcd_client.h"
+
+void LCD_ClientInit(LCD_Client *client, LCD_ClientSink sink, void *context) {
+    client->sink = sink;
+    client->context = context;
+    client->fill = 0;
+    client->error = 0;
+    client->sent = 0;
+}
+
+/* Send what is buffered. Returns 0, or -1 if any send failed so far. */
+int LCD_ClientFlush(LCD_Client *client) {
+    if (client->fill && !client->error) {
+        if (client->sink(client->context, client->buffer, client->fill) != 0)
+            client->error = 1;
+        else
+            client->sent += client->fill;
+    }
+    client->fill = 0;
+    return client->error ? -1 : 0;
+}
+
+/* Room for "length" more bytes, flushing first if needed */
+static uint8_t *LCD_ClientReserve(LCD_Client *client, int length) {
+    uint8_t *data;
+    
+    if (client->fill + length > LCD_CLIENT_BUFFER)
+        LCD_ClientFlush(client);
+    data = client->buffer + client->fill;
+    client->fill += length;
+    return data;
+}
+
+/* Header of "size" bytes: code, flags, then the 16 bit arguments */
+static void LCD_ClientHeader(LCD_Client *client, uint8_t code, uint8_t flags, uint8_t size,
+                             const uint16_t *args) {
+    uint8_t *data = LCD_ClientReserve(client, size);
+    uint8_t index;
+    
+    data[0] = code;
+    data[1] = flags;
+    for (index = 0; index < (size - 2) / 2; index++) {
+        data[2 + index * 2] = (uint8_t)args[index];
+        data[3 + index * 2] = (uint8_t)(args[index] >> 8);
+    }
+}
+
+void LCD_ClientFillRect(LCD_Client *client, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                        uint16_t color) {
+    uint16_t args[] = {(uint16_t)x, (uint16_t)y, w, h, color};
+    
+    LCD_ClientHeader(client, LCD_USB_REQ_FILL, 0, LCD_USB_FILL_REQ_SIZE, args);
+}
+
+void LCD_ClientLine(LCD_Client *client, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    uint16_t color) {
+    uint16_t args[] = {(uint16_t)x0, (uint16_t)y0, (uint16_t)x1, (uint16_t)y1, color};
+    
+    LCD_ClientHeader(client, LCD_USB_REQ_LINE, 0, LCD_USB_LINE_REQ_SIZE, args);
+}
+
+/* Strings longer than LCD_USB_TEXT_MAX are cut there */
+void LCD_ClientText(LCD_Client *client, int16_t x, int16_t y, uint16_t text, uint16_t back,
+                    uint8_t aa, const char *string) {
+    uint16_t length = strlen(string) > LCD_USB_TEXT_MAX ? LCD_USB_TEXT_MAX : strlen(string);
+    uint16_t args[] = {(uint16_t)x, (uint16_t)y, text, back, length};
+    uint16_t padded = (length + 1) & ~1;
+    uint8_t *data;
+    
+    LCD_ClientHeader(client, LCD_USB_REQ_TEXT, aa ? LCD_USB_TEXT_AA : 0,
+                     LCD_USB_TEXT_REQ_SIZE, args);
+    data = LCD_ClientReserve(client, padded);
+    memcpy(data, string, length);
+    if (padded != length)
+        data[length] = 0;
+}
+
+void LCD_ClientAsset(LCD_Client *client, uint16_t id, int16_t x, int16_t y) {
+    uint16_t args[] = {id, (uint16_t)x, (uint16_t)y};
+    
+    LCD_ClientHeader(client, LCD_USB_REQ_ASSET, 0, LCD_USB_ASSET_REQ_SIZE, args);
+}
+
+void LCD_ClientScroll(LCD_Client *client, uint16_t x, uint16_t w, uint16_t lines) {
+    uint16_t args[] = {x, w, lines};
+    
+    LCD_ClientHeader(client, LCD_USB_REQ_SCROLL, 0, LCD_USB_SCROLL_REQ_SIZE, args);
+}
@@ -0,0 +1,42 @@
+/*
+ * Drawing commands for the display's USB interface (see lcd_usb_proto.h).
+ *
+ * Commands are packed into a buffer and sent as one transfer when it fills
+ * up or on LCD_ClientFlush(), so a dashboard update costs a few dozen bytes
+ * instead of a frame of pixels. The transport is a callback: LCD_HostSink()
+ * for the board, or anything that feeds lcd_usb.c directly (sim loopback).
+ */
+
+#ifndef __LCD_CLIENT_H
+#define __LCD_CLIENT_H
+
+#include <stdint.h>
+#include "lcd_usb_proto.h"
+
+#define LCD_CLIENT_BUFFER        2048
+
+/* Sends "length" bytes, returns 0 or -1 */
+typedef int (*LCD_ClientSink)(void *context, const uint8_t *data, int length);
+
+typedef struct {
+    LCD_ClientSink sink;
+    void          *context;
+    uint8_t        buffer[LCD_CLIENT_BUFFER];
+    int            fill;
+    int            error;       /* a send failed, sticky */
+    uint32_t       sent;        /* bytes handed to the sink */
+} LCD_Client;
+
+void LCD_ClientInit(LCD_Client *client, LCD_ClientSink sink, void *context);
+int LCD_ClientFlush(LCD_Client *client);
+
+void LCD_ClientFillRect(LCD_Client *client, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                        uint16_t color);
+void LCD_ClientLine(LCD_Client *client, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    uint16_t color);
+void LCD_ClientText(LCD_Client *client, int16_t x, int16_t y, uint16_t text, uint16_t back,
+                    uint8_t aa, const char *string);
+void LCD_ClientAsset(LCD_Client *client, uint16_t id, int16_t x, int16_t y);
+void LCD_ClientScroll(LCD_Client *client, uint16_t x, uint16_t w, uint16_t lines);
+
+#endif /* __LCD_CLIENT_H */
@@ -0,0 +1,97 @@
+/*
+ * Live CPU load dashboard drawn with drawing commands (lcd_client.h):
+ * a history graph, a bar and a percentage, ten updates per second. Prints
+ * the USB traffic it needed.
+ *
+ *   lcd_dash [seconds]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "lcd_host.h"
+#include "lcd_client.h"
+
+#define DASH_RGB(r, g, b)   ((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | ((b) >> 3))
+#define DASH_BLACK          0x0000
+#define DASH_WHITE          0xFFFF
+#define DASH_GREEN          DASH_RGB(0, 200, 0)
+#define DASH_GREY           DASH_RGB(60, 60, 60)
+
+#define DASH_GRAPH_X        10
+#define DASH_GRAPH_Y        40
+#define DASH_GRAPH_W        300
+#define DASH_GRAPH_H        150
+
+/* Busy share of all CPU time since the previous call, in percent */
+static int Dash_CPULoad(void) {
+    static unsigned long long last_busy, last_total;
+    unsigned long long user, nice, system, idle, iowait, irq, softirq, busy, total;
+    int load = 0;
+    FILE *file = fopen("/proc/stat", "r");
+    
+    if (!file)
+        return 0;
+    if (fscanf(file, "cpu %llu %llu %llu %llu %llu %llu %llu",
+               &user, &nice, &system, &idle, &iowait, &irq, &softirq) == 7) {
+        busy = user + nice + system + irq + softirq;
+        total = busy + idle + iowait;
+        if (total != last_total)
+            load = (int)(100 * (busy - last_busy) / (total - last_total));
+        last_busy = busy;
+        last_total = total;
+    }
+    fclose(file);
+    return load;
+}
+
+int main(int argc, char **argv) {
+    static LCD_Client client;
+    struct timespec tick = {0, 100000000};
+    int seconds = argc > 1 ? atoi(argv[1]) : 10;
+    int updates = seconds * 10, update, load, y, last_y = DASH_GRAPH_Y + DASH_GRAPH_H - 1;
+    libusb_device_handle *device;
+    char text[32];
+    
+    device = LCD_HostOpen();
+    if (!device)
+        return 1;
+    LCD_ClientInit(&client, LCD_HostSink, device);
+    LCD_ClientScroll(&client, 0, 320, 0);
+    LCD_ClientFillRect(&client, 0, 0, 320, 240, DASH_BLACK);
+    LCD_ClientText(&client, 10, 10, DASH_WHITE, DASH_BLACK, 1, "CPU load");
+    LCD_ClientFillRect(&client, DASH_GRAPH_X - 1, DASH_GRAPH_Y - 1, DASH_GRAPH_W + 2,
+                       DASH_GRAPH_H + 2, DASH_GREY);
+    LCD_ClientFillRect(&client, DASH_GRAPH_X, DASH_GRAPH_Y, DASH_GRAPH_W, DASH_GRAPH_H,
+                       DASH_BLACK);
+    Dash_CPULoad();
+    
+    for (update = 0; update < updates; update++) {
+        nanosleep(&tick, NULL);
+        load = Dash_CPULoad();
+        
+        /* One graph column per update, wrapping around */
+        y = DASH_GRAPH_Y + DASH_GRAPH_H - 1 - load * (DASH_GRAPH_H - 1) / 100;
+        LCD_ClientFillRect(&client, DASH_GRAPH_X + (update + 1) % DASH_GRAPH_W, DASH_GRAPH_Y,
+                           1, DASH_GRAPH_H, DASH_GREY);
+        LCD_ClientFillRect(&client, DASH_GRAPH_X + update % DASH_GRAPH_W, DASH_GRAPH_Y,
+                           1, DASH_GRAPH_H, DASH_BLACK);
+        if (update % DASH_GRAPH_W)
+            LCD_ClientLine(&client, DASH_GRAPH_X + update % DASH_GRAPH_W - 1, last_y,
+                           DASH_GRAPH_X + update % DASH_GRAPH_W, y, DASH_GREEN);
+        last_y = y;
+        
+        LCD_ClientFillRect(&client, 10, 200, load * 2, 20, DASH_GREEN);
+        LCD_ClientFillRect(&client, 10 + load * 2, 200, 200 - load * 2, 20, DASH_GREY);
+        snprintf(text, sizeof(text), "%3d %%", load);
+        LCD_ClientText(&client, 230, 202, DASH_WHITE, DASH_BLACK, 1, text);
+        if (LCD_ClientFlush(&client) != 0) {
+            fprintf(stderr, "send failed\n");
+            return 1;
+        }
+    }
+    LCD_HostClose(device);
+    printf("%d updates, %lu bytes, %.1f bytes/update\n",
+           updates, (unsigned long)client.sent, (double)client.sent / (updates ? updates : 1));
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Host side of the display's vendor bulk interface (libusb-1.0).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "lcd_host.h"
+#include "lcd_usb_proto.h"
+
+/* Open the board and claim its vendor interface, 0 on failure */
+libusb_device_handle *LCD_HostOpen(void) {
+    libusb_device_handle *device;
+    
+    if (libusb_init(NULL) != 0)
+        return NULL;
+    device = libusb_open_device_with_vid_pid(NULL, LCD_USB_VID, LCD_USB_PID);
+    if (!device) {
+        fprintf(stderr, "no display %04x:%04x found\n", LCD_USB_VID, LCD_USB_PID);
+        libusb_exit(NULL);
+        return NULL;
+    }
+    libusb_set_auto_detach_kernel_driver(device, 1);
+    if (libusb_claim_interface(device, 0) != 0) {
+        fprintf(stderr, "cannot claim the display interface\n");
+        libusb_close(device);
+        libusb_exit(NULL);
+        return NULL;
+    }
+    return device;
+}
+
+void LCD_HostClose(libusb_device_handle *device) {
+    libusb_release_interface(device, 0);
+    libusb_close(device);
+    libusb_exit(NULL);
+}
+
+/*
+ * Returns the number of bytes written, or -1. A transfer that ends on a
+ * full packet is closed with a zero length packet, without it the board
+ * would hold the data until the next transfer.
+ */
+int LCD_HostWrite(libusb_device_handle *device, const uint8_t *data, int length) {
+    int done = 0, zlp;
+    
+    if (libusb_bulk_transfer(device, LCD_HOST_OUT_EP, (uint8_t *)data, length, &done,
+                             LCD_HOST_TIMEOUT_MS) != 0)
+        return -1;
+    if (length > 0 && length % LCD_USB_MAX_PACKET == 0 &&
+        libusb_bulk_transfer(device, LCD_HOST_OUT_EP, (uint8_t *)data, 0, &zlp,
+                             LCD_HOST_TIMEOUT_MS) != 0)
+        return -1;
+    return done;
+}
+
+/* LCD_ClientSink for lcd_client.c, "device" is the libusb handle */
+int LCD_HostSink(void *device, const uint8_t *data, int length) {
+    return LCD_HostWrite(device, data, length) == length ? 0 : -1;
+}
+
+/* One read of up to "length" bytes, ends early on a short packet */
+int LCD_HostRead(libusb_device_handle *device, uint8_t *data, int length) {
+    int done = 0;
+    
+    if (libusb_bulk_transfer(device, LCD_HOST_IN_EP, data, length, &done,
+                             LCD_HOST_TIMEOUT_MS) != 0)
+        return -1;
+    return done;
+}
+
+/*
+ * Draw w*h RGB565 pixels at [x,y]. Header and pixels go out as one
+ * transfer so the board can overlap reception with writing GRAM.
+ * Returns 0, or -1 on error.
+ */
+int LCD_HostBlit(libusb_device_handle *device, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                 const uint16_t *pixels) {
+    uint32_t count = (uint32_t)w * h, index;
+    int length = LCD_USB_BLIT_REQ_SIZE + count * 2;
+    uint8_t *data = malloc(length), *out;
+    int done;
+    
+    if (!data)
+        return -1;
+    data[0] = LCD_USB_REQ_BLIT;
+    data[1] = 0;
+    data[2] = (uint8_t)x; data[3] = (uint8_t)(x >> 8);
+    data[4] = (uint8_t)y; data[5] = (uint8_t)(y >> 8);
+    data[6] = (uint8_t)w; data[7] = (uint8_t)(w >> 8);
+    data[8] = (uint8_t)h; data[9] = (uint8_t)(h >> 8);
+    out = data + LCD_USB_BLIT_REQ_SIZE;
+    for (index = 0; index < count; index++) {
+        *out++ = (uint8_t)pixels[index];
+        *out++ = (uint8_t)(pixels[index] >> 8);
+    }
+    done = LCD_HostWrite(device, data, length);
+    free(data);
+    return done == length ? 0 : -1;
+}
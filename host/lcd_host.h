@@ -0,0 +1,23 @@
+/*
+ * Host side of the display's vendor bulk interface (libusb-1.0).
+ */
+
+#ifndef __LCD_HOST_H
+#define __LCD_HOST_H
+
+#include <stdint.h>
+#include <libusb-1.0/libusb.h>
+
+#define LCD_HOST_IN_EP           0x81
+#define LCD_HOST_OUT_EP          0x01
+#define LCD_HOST_TIMEOUT_MS      2000
+
+libusb_device_handle *LCD_HostOpen(void);
+void LCD_HostClose(libusb_device_handle *device);
+int LCD_HostWrite(libusb_device_handle *device, const uint8_t *data, int length);
+int LCD_HostRead(libusb_device_handle *device, uint8_t *data, int length);
+int LCD_HostSink(void *device, const uint8_t *data, int length);
+int LCD_HostBlit(libusb_device_handle *device, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                 const uint16_t *pixels);
+
+#endif /* __LCD_HOST_H */
@@ -0,0 +1,109 @@
+/*
+ * Push frames to the display over USB and report the sustained rate.
+ *
+ *   lcd_push [frames]          moving test pattern, full screen blits
+ *   lcd_push image.ppm [x y]   one binary PPM (P6), drawn at [x,y]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lcd_host.h"
+
+#define PUSH_WIDTH      320
+#define PUSH_HEIGHT     240
+
+static uint16_t Push_RGB565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+/* Read a P6 PPM with maxval 255, NULL on error */
+static uint16_t *Push_ReadPPM(const char *path, int *width, int *height) {
+    FILE *file = fopen(path, "rb");
+    uint16_t *pixels;
+    uint8_t rgb[3];
+    int max, index;
+    
+    if (!file)
+        return NULL;
+    if (fscanf(file, "P6 %d %d %d", width, height, &max) != 3 || max != 255 ||
+        *width <= 0 || *height <= 0 || fgetc(file) == EOF) {
+        fclose(file);
+        return NULL;
+    }
+    pixels = malloc((size_t)*width * *height * sizeof(uint16_t));
+    for (index = 0; pixels && index < *width * *height; index++) {
+        if (fread(rgb, 1, 3, file) != 3) {
+            free(pixels);
+            pixels = NULL;
+            break;
+        }
+        pixels[index] = Push_RGB565(rgb[0], rgb[1], rgb[2]);
+    }
+    fclose(file);
+    return pixels;
+}
+
+/* Diagonal color bands, shifted by "frame" */
+static void Push_Pattern(uint16_t *pixels, int frame) {
+    int x, y;
+    
+    for (y = 0; y < PUSH_HEIGHT; y++)
+        for (x = 0; x < PUSH_WIDTH; x++)
+            pixels[y * PUSH_WIDTH + x] = Push_RGB565((x + frame) * 2, (y + frame) * 3,
+                                                     (x + y + frame * 4) & 0xFF);
+}
+
+static double Push_Seconds(const struct timespec *start, const struct timespec *end) {
+    return (end->tv_sec - start->tv_sec) + (end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+int main(int argc, char **argv) {
+    libusb_device_handle *device;
+    uint16_t *pixels;
+    int frames = 100, width = PUSH_WIDTH, height = PUSH_HEIGHT, x = 0, y = 0, frame;
+    struct timespec start, end;
+    double seconds, bytes;
+    
+    if (argc > 1 && strstr(argv[1], ".ppm")) {
+        pixels = Push_ReadPPM(argv[1], &width, &height);
+        if (!pixels) {
+            fprintf(stderr, "cannot read %s\n", argv[1]);
+            return 1;
+        }
+        if (argc > 3) {
+            x = atoi(argv[2]);
+            y = atoi(argv[3]);
+        }
+        frames = 1;
+    } else {
+        if (argc > 1)
+            frames = atoi(argv[1]);
+        pixels = malloc(PUSH_WIDTH * PUSH_HEIGHT * sizeof(uint16_t));
+        if (!pixels || frames <= 0)
+            return 1;
+    }
+    
+    device = LCD_HostOpen();
+    if (!device)
+        return 1;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (frame = 0; frame < frames; frame++) {
+        if (frames > 1)
+            Push_Pattern(pixels, frame);
+        if (LCD_HostBlit(device, x, y, width, height, pixels) != 0) {
+            fprintf(stderr, "blit failed at frame %d\n", frame);
+            return 1;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    LCD_HostClose(device);
+    
+    seconds = Push_Seconds(&start, &end);
+    bytes = (double)frames * width * height * 2;
+    printf("%d frame(s) of %dx%d in %.2f s: %.1f fps, %.2f Mbit/s\n",
+           frames, width, height, seconds, frames / seconds, bytes * 8 / seconds / 1e6);
+    free(pixels);
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Grab the display contents over USB and save them as a PPM file.
+ *
+ *   lcd_screenshot [file.ppm]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lcd_host.h"
+#include "lcd_rle.h"
+#include "lcd_usb_proto.h"
+
+/* Device tokens never exceed one row, so the leftover fits next to a read */
+#define SHOT_READ_SIZE  16384
+
+static int SavePPM(const char *path, const uint16_t *pixels, int width, int height) {
+    FILE *file = fopen(path, "wb");
+    int index;
+    
+    if (!file)
+        return -1;
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    for (index = 0; index < width * height; index++) {
+        fputc(((pixels[index] >> 11) & 0x1F) * 255 / 31, file);
+        fputc(((pixels[index] >> 5) & 0x3F) * 255 / 63, file);
+        fputc((pixels[index] & 0x1F) * 255 / 31, file);
+    }
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : "screenshot.ppm";
+    static uint8_t stream[2 * SHOT_READ_SIZE];
+    uint8_t request[LCD_USB_SHOT_REQ_SIZE] = { LCD_USB_REQ_SCREENSHOT, 0 };
+    libusb_device_handle *device;
+    uint16_t *pixels = NULL;
+    uint32_t have = 0, used, decoded, total = 0, count = 0, received = 0;
+    int width = 0, height = 0, got;
+    struct timespec start, end;
+    
+    device = LCD_HostOpen();
+    if (!device)
+        return 1;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (LCD_HostWrite(device, request, LCD_USB_SHOT_REQ_SIZE) != LCD_USB_SHOT_REQ_SIZE) {
+        fprintf(stderr, "request failed\n");
+        return 1;
+    }
+    
+    while (!pixels || count < total) {
+        got = LCD_HostRead(device, stream + have, SHOT_READ_SIZE);
+        if (got < 0) {
+            fprintf(stderr, "read failed after %u pixels\n", count);
+            return 1;
+        }
+        have += got;
+        received += got;
+        
+        used = 0;
+        if (!pixels) {
+            if (have < LCD_USB_SHOT_HEADER)
+                continue;
+            if (stream[0] != LCD_USB_SHOT_MAGIC0 || stream[1] != LCD_USB_SHOT_MAGIC1) {
+                fprintf(stderr, "not a screenshot reply\n");
+                return 1;
+            }
+            width = stream[2] | (stream[3] << 8);
+            height = stream[4] | (stream[5] << 8);
+            total = (uint32_t)width * height;
+            pixels = malloc(total * sizeof(uint16_t));
+            if (!pixels)
+                return 1;
+            used = LCD_USB_SHOT_HEADER;
+        }
+        used += LCD_RLEDecode(stream + used, have - used, pixels + count, total - count, &decoded);
+        count += decoded;
+        memmove(stream, stream + used, have - used);
+        have -= used;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    LCD_HostClose(device);
+    
+    if (SavePPM(path, pixels, width, height) != 0) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    printf("%s: %dx%d, %u bytes (%.1f%% of raw) in %.3f s\n", path, width, height, received,
+           100.0 * received / (total * 2 + LCD_USB_SHOT_HEADER),
+           (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+    free(pixels);
+    return 0;
+}
@@ -0,0 +1,256 @@
+/*
+ * Drawing benchmarks timed with the Cortex-M4 DWT cycle counter.
+ */
+
+#include "lcd_bench.h"
+#include "SSD1289.h"
+
+#define LCD_BENCH_STRIP_HEIGHT   48
+#define LCD_BENCH_REPEAT         100
+
+LCD_BenchResult LCD_BenchResults[LCD_BENCH_MAX_RESULTS];
+uint8_t LCD_BenchCount = 0;
+
+/* Source image for the blit workloads, one strip of the screen */
+static uint16_t LCD_BenchStrip[LCD_PIXEL_WIDTH * LCD_BENCH_STRIP_HEIGHT];
+
+static void LCD_BenchRecord(const char *name, uint32_t cycles, uint32_t cpu_cycles,
+                            uint32_t pixels, uint32_t items) {
+    LCD_BenchResult *result;
+    
+    if (LCD_BenchCount >= LCD_BENCH_MAX_RESULTS)
+        return;
+    result = &LCD_BenchResults[LCD_BenchCount++];
+    result->name = name;
+    result->cycles = cycles;
+    result->cpu_cycles = cpu_cycles;
+    result->pixels = pixels;
+    result->items = items;
+    /* pixels per millisecond is kPixel/s, i.e. MPixel/s * 1000 */
+    result->mpixel_x1000 = cycles ? (uint32_t)(((uint64_t)pixels * (SystemCoreClock / 1000)) / cycles) : 0;
+    result->items_per_s = cycles ? (uint32_t)(((uint64_t)items * SystemCoreClock) / cycles) : 0;
+}
+
+static void LCD_BenchClear(void) {
+    uint32_t start, returned, done;
+    uint32_t pixels = (uint32_t)LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT;
+    
+    start = LCD_CYCLES();
+    LCD_Clear(BLUE);
+    done = LCD_CYCLES();
+    LCD_BenchRecord("clear cpu", done - start, done - start, pixels, 1);
+    
+    start = LCD_CYCLES();
+    LCD_ClearAsync(RED, 0);
+    returned = LCD_CYCLES();
+    LCD_WaitDMA();
+    done = LCD_CYCLES();
+    LCD_BenchRecord("clear dma", done - start, returned - start, pixels, 1);
+}
+
+static void LCD_BenchBitmap(void) {
+    uint32_t start, returned, done, index;
+    uint16_t y;
+    
+    for (index = 0; index < LCD_PIXEL_WIDTH * LCD_BENCH_STRIP_HEIGHT; index++)
+        LCD_BenchStrip[index] = ASSEMBLE_RGB(index % LCD_PIXEL_WIDTH, index / LCD_PIXEL_WIDTH * 5, 0x80);
+    
+    /* Full screen from five contiguous strips */
+    start = LCD_CYCLES();
+    for (y = 0; y < LCD_PIXEL_HEIGHT; y += LCD_BENCH_STRIP_HEIGHT)
+        LCD_DrawBitmap(0, y, LCD_PIXEL_WIDTH, LCD_BENCH_STRIP_HEIGHT, LCD_BenchStrip);
+    done = LCD_CYCLES();
+    LCD_BenchRecord("blit 320x240", done - start, done - start, (uint32_t)LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT, 5);
+    
+    /* 100x48 sub-rectangle, one chained transfer per row */
+    start = LCD_CYCLES();
+    LCD_DrawBitmapAsync(110, 96, 100, LCD_BENCH_STRIP_HEIGHT, &LCD_BenchStrip[100], LCD_PIXEL_WIDTH, 0);
+    returned = LCD_CYCLES();
+    LCD_WaitDMA();
+    done = LCD_CYCLES();
+    LCD_BenchRecord("blit sub 100x48", done - start, returned - start, 100 * LCD_BENCH_STRIP_HEIGHT, 1);
+}
+
+static void LCD_BenchText(void) {
+    static const char line[] = "Status: 0123456789 ";
+    uint32_t start, done;
+    uint16_t y, glyphs = 0;
+    uint16_t old_size = asciisize;
+    
+    LCD_SetTextColors(WHITE, BLACK);
+    asciisize = 16;
+    start = LCD_CYCLES();
+    for (y = 0; y + 16 <= LCD_PIXEL_HEIGHT; y += 16) {
+        LCD_DrawString(0, y, line);
+        glyphs += sizeof(line) - 1;
+    }
+    done = LCD_CYCLES();
+    asciisize = old_size;
+    LCD_BenchRecord("text 12x16", done - start, done - start, (uint32_t)glyphs * 12 * 16, glyphs);
+    
+    glyphs = 0;
+    start = LCD_CYCLES();
+    for (y = 0; y + 16 <= LCD_PIXEL_HEIGHT; y += 16) {
+        LCD_DrawStringAA(0, y, line);
+        glyphs += sizeof(line) - 1;
+    }
+    done = LCD_CYCLES();
+    LCD_BenchRecord("text aa 12x16", done - start, done - start, (uint32_t)glyphs * 12 * 16, glyphs);
+}
+
+static void LCD_BenchCursor(void) {
+    uint32_t start, done;
+    uint16_t index;
+    
+    start = LCD_CYCLES();
+    for (index = 0; index < LCD_BENCH_REPEAT; index++)
+        LCD_SetCursor(index, index);
+    done = LCD_CYCLES();
+    LCD_BenchRecord("set cursor", done - start, done - start, 0, LCD_BENCH_REPEAT);
+}
+
+static void LCD_BenchRects(void) {
+    static const uint16_t sizes[] = {8, 32, 100, 240};
+    static const char *const names[] = {"rect 8x8", "rect 32x32", "rect 100x100", "rect 240x240"};
+    uint32_t start, done;
+    uint16_t index, size, count;
+    uint8_t item;
+    
+    for (item = 0; item < sizeof(sizes) / sizeof(sizes[0]); item++) {
+        size = sizes[item];
+        count = size < 100 ? LCD_BENCH_REPEAT : 10;
+        start = LCD_CYCLES();
+        for (index = 0; index < count; index++)
+            LCD_FillRect(index % (LCD_PIXEL_WIDTH - size + 1), 0, size, size, index << 4);
+        done = LCD_CYCLES();
+        LCD_BenchRecord(names[item], done - start, done - start, (uint32_t)size * size * count, count);
+    }
+}
+
+static void LCD_BenchLines(void) {
+    uint32_t start, done, pixels = 0;
+    uint16_t index;
+    int16_t x0, y0, x1, y1;
+    
+    start = LCD_CYCLES();
+    for (index = 0; index < LCD_PIXEL_HEIGHT; index++)
+        LCD_DrawLine(0, index, LCD_PIXEL_WIDTH - 1, index, index << 5);
+    done = LCD_CYCLES();
+    LCD_BenchRecord("line horizontal", done - start, done - start,
+                    (uint32_t)LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT, LCD_PIXEL_HEIGHT);
+    
+    start = LCD_CYCLES();
+    for (index = 0; index < LCD_PIXEL_WIDTH; index++)
+        LCD_DrawLine(index, 0, index, LCD_PIXEL_HEIGHT - 1, index << 5);
+    done = LCD_CYCLES();
+    LCD_BenchRecord("line vertical", done - start, done - start,
+                    (uint32_t)LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT, LCD_PIXEL_WIDTH);
+    
+    /* Fan of lines through the center, all slopes */
+    start = LCD_CYCLES();
+    for (index = 0; index < LCD_BENCH_REPEAT; index++) {
+        x0 = (index * 37) % LCD_PIXEL_WIDTH;
+        y0 = 0;
+        x1 = LCD_PIXEL_WIDTH - 1 - x0;
+        y1 = LCD_PIXEL_HEIGHT - 1;
+        if (index & 1) {
+            x0 = 0;
+            y0 = (index * 23) % LCD_PIXEL_HEIGHT;
+            x1 = LCD_PIXEL_WIDTH - 1;
+            y1 = LCD_PIXEL_HEIGHT - 1 - y0;
+        }
+        LCD_DrawLine(x0, y0, x1, y1, index << 7);
+        pixels += 1 + (LCD_ABS(x1 - x0) > LCD_ABS(y1 - y0) ? LCD_ABS(x1 - x0) : LCD_ABS(y1 - y0));
+    }
+    done = LCD_CYCLES();
+    LCD_BenchRecord("line sloped", done - start, done - start, pixels, LCD_BENCH_REPEAT);
+}
+
+static void LCD_BenchShapes(void) {
+    static const Point star[] = {
+        {160, 20}, {185, 95}, {260, 95}, {200, 140}, {225, 215},
+        {160, 170}, {95, 215}, {120, 140}, {60, 95}, {135, 95}
+    };
+    uint32_t start, done;
+    uint16_t index;
+    
+    start = LCD_CYCLES();
+    for (index = 0; index < 10; index++)
+        LCD_FillCircle(160, 120, 100, index << 11);
+    done = LCD_CYCLES();
+    /* pi * r^2 */
+    LCD_BenchRecord("fill circle r100", done - start, done - start, 10 * 31416, 10);
+    
+    start = LCD_CYCLES();
+    for (index = 0; index < 10; index++)
+        LCD_DrawCircle(160, 120, 100, index << 11);
+    done = LCD_CYCLES();
+    LCD_BenchRecord("circle r100", done - start, done - start, 10 * 628, 10);
+    
+    start = LCD_CYCLES();
+    for (index = 0; index < 10; index++)
+        LCD_FillPolygon(star, sizeof(star) / sizeof(star[0]), index << 5);
+    done = LCD_CYCLES();
+    /* Pixels inside the star, counted on the simulator */
+    LCD_BenchRecord("polygon star", done - start, done - start, 10 * 13080, 10);
+}
+
+void LCD_BenchRun(void) {
+    LCD_BenchCount = 0;
+    LCD_CyclesInit();
+    
+    LCD_BenchClear();
+    LCD_BenchCursor();
+    LCD_BenchRects();
+    LCD_BenchBitmap();
+    LCD_BenchText();
+    LCD_BenchLines();
+    LCD_BenchShapes();
+}
+
+/* Right aligned decimal number, "frac" digits after a decimal point */
+static char *LCD_BenchFormat(char *end, uint32_t value, uint8_t width, uint8_t frac) {
+    char *text = end;
+    uint8_t digits = 0;
+    
+    *text = 0;
+    do {
+        if (frac && digits == frac)
+            *--text = '.';
+        *--text = '0' + value % 10;
+        value /= 10;
+        digits++;
+    } while (value != 0 || digits <= frac);
+    while (text > end - width)
+        *--text = ' ';
+    return text;
+}
+
+/*
+ * One line per result: name, total cycles and MPixel/s (or items/s for
+ * workloads without a pixel count).
+ */
+void LCD_BenchShow(void) {
+    char number[16];
+    uint16_t old_size = asciisize;
+    uint8_t index;
+    int16_t y = 0;
+    LCD_BenchResult *result;
+    
+    LCD_ClearDMA(BLACK);
+    LCD_SetTextColors(WHITE, BLACK);
+    asciisize = 8;
+    for (index = 0; index < LCD_BenchCount && y + 8 <= LCD_PIXEL_HEIGHT; index++, y += 8) {
+        result = &LCD_BenchResults[index];
+        LCD_DrawString(0, y, result->name);
+        LCD_DrawString(108, y, LCD_BenchFormat(number + sizeof(number) - 1, result->cycles, 10, 0));
+        if (result->pixels) {
+            LCD_DrawString(174, y, LCD_BenchFormat(number + sizeof(number) - 1, result->mpixel_x1000, 8, 3));
+            LCD_DrawString(228, y, "MPix/s");
+        }else{
+            LCD_DrawString(174, y, LCD_BenchFormat(number + sizeof(number) - 1, result->items_per_s, 8, 0));
+            LCD_DrawString(228, y, "/s");
+        }
+    }
+    asciisize = old_size;
+}
@@ -0,0 +1,31 @@
+/*
+ * Drawing benchmarks timed with the Cortex-M4 DWT cycle counter.
+ *
+ * Build with "make BENCH=1" and run on the board. The results are shown on
+ * the panel when the run ends and stay in LCD_BenchResults for the debugger.
+ */
+
+#ifndef __LCD_BENCH_H
+#define __LCD_BENCH_H
+
+#include "stm32f4xx.h"
+
+#define LCD_BENCH_MAX_RESULTS    32
+
+typedef struct {
+    const char *name;
+    uint32_t    cycles;         /* total cycles until the panel got the last pixel */
+    uint32_t    cpu_cycles;     /* cycles the CPU was blocked inside the call */
+    uint32_t    pixels;
+    uint32_t    items;          /* glyphs, lines, ... drawn by the workload */
+    uint32_t    mpixel_x1000;   /* MPixel/s * 1000 */
+    uint32_t    items_per_s;
+} LCD_BenchResult;
+
+extern LCD_BenchResult LCD_BenchResults[LCD_BENCH_MAX_RESULTS];
+extern uint8_t LCD_BenchCount;
+
+void LCD_BenchRun(void);
+void LCD_BenchShow(void);
+
+#endif /* __LCD_BENCH_H */
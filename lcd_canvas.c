@@ -0,0 +1,207 @@
+/*
+ * Off-screen RGB565 canvas in CCM RAM with dirty rectangle tracking.
+ */
+
+#include "lcd_canvas.h"
+
+/* CCM RAM is not reachable by DMA, LCD_Flush() copies with the CPU */
+static uint16_t LCD_CanvasBuffer[LCD_CANVAS_PIXELS] __attribute__ ((section (".ccmram")));
+
+static LCD_Rect LCD_CanvasArea;
+static LCD_Rect LCD_CanvasDirty[LCD_CANVAS_MAX_DIRTY];
+static uint8_t  LCD_CanvasDirtyCount = 0;
+
+/*
+ * Clip [x,y,w,h] to the canvas area. Returns 0 if nothing is left.
+ */
+static uint8_t LCD_CanvasClip(LCD_Rect *rect, int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    int32_t x_end = (int32_t)x + w;
+    int32_t y_end = (int32_t)y + h;
+    int32_t area_x_end = (int32_t)LCD_CanvasArea.x + LCD_CanvasArea.w;
+    int32_t area_y_end = (int32_t)LCD_CanvasArea.y + LCD_CanvasArea.h;
+    
+    if (x < LCD_CanvasArea.x) x = LCD_CanvasArea.x;
+    if (y < LCD_CanvasArea.y) y = LCD_CanvasArea.y;
+    if (x_end > area_x_end) x_end = area_x_end;
+    if (y_end > area_y_end) y_end = area_y_end;
+    if (x_end <= x || y_end <= y)
+        return 0;
+    
+    rect->x = x;
+    rect->y = y;
+    rect->w = x_end - x;
+    rect->h = y_end - y;
+    return 1;
+}
+
+static uint32_t LCD_RectArea(const LCD_Rect *rect) {
+    return (uint32_t)rect->w * rect->h;
+}
+
+static void LCD_RectUnion(LCD_Rect *result, const LCD_Rect *a, const LCD_Rect *b) {
+    int16_t x = a->x < b->x ? a->x : b->x;
+    int16_t y = a->y < b->y ? a->y : b->y;
+    int32_t x_end = (int32_t)a->x + a->w;
+    int32_t y_end = (int32_t)a->y + a->h;
+    
+    if ((int32_t)b->x + b->w > x_end) x_end = (int32_t)b->x + b->w;
+    if ((int32_t)b->y + b->h > y_end) y_end = (int32_t)b->y + b->h;
+    result->x = x;
+    result->y = y;
+    result->w = x_end - x;
+    result->h = y_end - y;
+}
+
+/* Overlapping or touching rectangles are merged */
+static uint8_t LCD_RectTouch(const LCD_Rect *a, const LCD_Rect *b) {
+    return a->x <= b->x + b->w && b->x <= a->x + a->w &&
+           a->y <= b->y + b->h && b->y <= a->y + a->h;
+}
+
+/*
+ * Place the canvas on the screen rectangle [x,y,w,h] (a band or a tile) and
+ * clear it to "color". The buffer is not loaded at boot, and merged dirty
+ * areas flush pixels that were never drawn, so they must hold the
+ * background. Returns 0 if the rectangle does not fit in the buffer or on
+ * the screen.
+ */
+uint8_t LCD_CanvasInit(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    uint16_t *pixel, *end;
+    
+    if (x < 0 || y < 0 || w == 0 || h == 0 ||
+        x + w > LCD_PIXEL_WIDTH || y + h > LCD_PIXEL_HEIGHT ||
+        (uint32_t)w * h > LCD_CANVAS_PIXELS)
+        return 0;
+    
+    LCD_CanvasArea.x = x;
+    LCD_CanvasArea.y = y;
+    LCD_CanvasArea.w = w;
+    LCD_CanvasArea.h = h;
+    LCD_CanvasDirtyCount = 0;
+    
+    end = &LCD_CanvasBuffer[(uint32_t)w * h];
+    for (pixel = LCD_CanvasBuffer; pixel < end; pixel++)
+        *pixel = color;
+    return 1;
+}
+
+/*
+ * Address of screen pixel [x,y] in the canvas, 0 if it is outside. Rows are
+ * LCD_CanvasArea.w pixels apart. Call LCD_CanvasInvalidate() after writing.
+ */
+uint16_t *LCD_CanvasPixel(int16_t x, int16_t y) {
+    if (x < LCD_CanvasArea.x || y < LCD_CanvasArea.y ||
+        x >= LCD_CanvasArea.x + LCD_CanvasArea.w || y >= LCD_CanvasArea.y + LCD_CanvasArea.h)
+        return 0;
+    return &LCD_CanvasBuffer[(uint32_t)(y - LCD_CanvasArea.y) * LCD_CanvasArea.w + (x - LCD_CanvasArea.x)];
+}
+
+/*
+ * Mark [x,y,w,h] for the next LCD_Flush(). Overlapping areas are merged,
+ * when the list is full the new area is merged into the entry that grows
+ * the least.
+ */
+void LCD_CanvasInvalidate(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    LCD_Rect rect, merged;
+    uint32_t growth, best_growth;
+    uint8_t index, best;
+    
+    if (!LCD_CanvasClip(&rect, x, y, w, h))
+        return;
+    
+    /* Merging can make the result touch entries checked before, so rescan */
+    index = 0;
+    while (index < LCD_CanvasDirtyCount) {
+        if (LCD_RectTouch(&rect, &LCD_CanvasDirty[index])) {
+            LCD_RectUnion(&rect, &rect, &LCD_CanvasDirty[index]);
+            LCD_CanvasDirty[index] = LCD_CanvasDirty[--LCD_CanvasDirtyCount];
+            index = 0;
+        }else{
+            index++;
+        }
+    }
+    
+    if (LCD_CanvasDirtyCount < LCD_CANVAS_MAX_DIRTY) {
+        LCD_CanvasDirty[LCD_CanvasDirtyCount++] = rect;
+        return;
+    }
+    
+    best = 0;
+    best_growth = 0xFFFFFFFF;
+    for (index = 0; index < LCD_CanvasDirtyCount; index++) {
+        LCD_RectUnion(&merged, &rect, &LCD_CanvasDirty[index]);
+        growth = LCD_RectArea(&merged) - LCD_RectArea(&LCD_CanvasDirty[index]);
+        if (growth < best_growth) {
+            best_growth = growth;
+            best = index;
+        }
+    }
+    LCD_RectUnion(&LCD_CanvasDirty[best], &rect, &LCD_CanvasDirty[best]);
+}
+
+void LCD_CanvasFillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    LCD_Rect rect;
+    uint16_t *row;
+    uint16_t col, line;
+    
+    if (!LCD_CanvasClip(&rect, x, y, w, h))
+        return;
+    
+    row = LCD_CanvasPixel(rect.x, rect.y);
+    for (line = 0; line < rect.h; line++) {
+        for (col = 0; col < rect.w; col++)
+            row[col] = color;
+        row += LCD_CanvasArea.w;
+    }
+    LCD_CanvasInvalidate(rect.x, rect.y, rect.w, rect.h);
+}
+
+void LCD_CanvasDrawBitmap(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap) {
+    LCD_Rect rect;
+    uint16_t *row;
+    uint16_t col, line;
+    
+    if (!LCD_CanvasClip(&rect, x, y, w, h))
+        return;
+    
+    bitmap += (uint32_t)(rect.y - y) * w + (rect.x - x);
+    row = LCD_CanvasPixel(rect.x, rect.y);
+    for (line = 0; line < rect.h; line++) {
+        for (col = 0; col < rect.w; col++)
+            row[col] = bitmap[col];
+        row += LCD_CanvasArea.w;
+        bitmap += w;
+    }
+    LCD_CanvasInvalidate(rect.x, rect.y, rect.w, rect.h);
+}
+
+void LCD_CanvasSetPixel(int16_t x, int16_t y, uint16_t color) {
+    uint16_t *pixel = LCD_CanvasPixel(x, y);
+    
+    if (pixel) {
+        *pixel = color;
+        LCD_CanvasInvalidate(x, y, 1, 1);
+    }
+}
+
+/*
+ * Send the dirty areas to GRAM, one window and one burst each.
+ */
+void LCD_Flush(void) {
+    const LCD_Rect *rect;
+    const uint16_t *row;
+    uint16_t col, line;
+    uint8_t index;
+    
+    for (index = 0; index < LCD_CanvasDirtyCount; index++) {
+        rect = &LCD_CanvasDirty[index];
+        LCD_SetWindow(rect->x, rect->y, rect->w, rect->h);
+        row = LCD_CanvasPixel(rect->x, rect->y);
+        for (line = 0; line < rect->h; line++) {
+            for (col = 0; col < rect->w; col++)
+                LCD_WRITE_DATA(row[col]);
+            row += LCD_CanvasArea.w;
+        }
+    }
+    LCD_CanvasDirtyCount = 0;
+}
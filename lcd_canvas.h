@@ -0,0 +1,31 @@
+/*
+ * Off-screen RGB565 canvas in CCM RAM with dirty rectangle tracking.
+ *
+ * The canvas covers one band or tile of the screen. Drawing goes to the
+ * canvas only, LCD_Flush() then sends the dirty areas to GRAM, so layered
+ * widgets never show half drawn on the panel.
+ */
+
+#ifndef __LCD_CANVAS_H
+#define __LCD_CANVAS_H
+
+#include "SSD1289.h"
+
+/* 320x96 pixels = 60 KB, which fits the 64 KB CCM RAM */
+#ifndef LCD_CANVAS_PIXELS
+#define LCD_CANVAS_PIXELS        (LCD_PIXEL_WIDTH * 96)
+#endif
+
+#ifndef LCD_CANVAS_MAX_DIRTY
+#define LCD_CANVAS_MAX_DIRTY     8
+#endif
+
+uint8_t LCD_CanvasInit(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+uint16_t *LCD_CanvasPixel(int16_t x, int16_t y);
+void LCD_CanvasInvalidate(int16_t x, int16_t y, uint16_t w, uint16_t h);
+void LCD_CanvasFillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+void LCD_CanvasDrawBitmap(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap);
+void LCD_CanvasSetPixel(int16_t x, int16_t y, uint16_t color);
+void LCD_Flush(void);
+
+#endif /* __LCD_CANVAS_H */
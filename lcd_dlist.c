@@ -0,0 +1,260 @@
+/*
+ * Display lists replayed from DMA completion interrupts.
+ */
+
+#include "lcd_dlist.h"
+
+#define LCD_DLIST_FILL           1
+#define LCD_DLIST_BITMAP         2
+#define LCD_DLIST_WINDOW         3
+
+/* Every command starts with this header, payload follows word aligned */
+typedef struct {
+    uint8_t  type;
+    uint8_t  reserved;
+    uint16_t words;     /* header and payload */
+    int16_t  x;
+    int16_t  y;
+    uint16_t w;
+    uint16_t h;
+} LCD_DListHeader;
+
+typedef struct {
+    const uint16_t *bitmap;
+    uint32_t        stride;
+} LCD_DListBitmapPayload;
+
+#define LCD_DLIST_HEADER_WORDS   (sizeof(LCD_DListHeader) / 4)
+
+static LCD_DList *LCD_DListCurrent = 0;
+static uint32_t LCD_DListPosition = 0;
+static LCD_DMACallback LCD_DListDone = 0;
+static __IO uint8_t LCD_DListActive = 0;
+
+/*
+ * Clip [x,y,w,h] to the screen. Returns 0 if nothing is left.
+ */
+static uint8_t LCD_DListClip(int16_t *x, int16_t *y, uint16_t *w, uint16_t *h) {
+    int32_t x_end = (int32_t)*x + *w;
+    int32_t y_end = (int32_t)*y + *h;
+    
+    if (*x < 0) *x = 0;
+    if (*y < 0) *y = 0;
+    if (x_end > LCD_PIXEL_WIDTH) x_end = LCD_PIXEL_WIDTH;
+    if (y_end > LCD_PIXEL_HEIGHT) y_end = LCD_PIXEL_HEIGHT;
+    if (x_end <= *x || y_end <= *y)
+        return 0;
+    *w = x_end - *x;
+    *h = y_end - *y;
+    return 1;
+}
+
+/*
+ * Reserve a command with "payload_bytes" of payload. Returns 0 if the list
+ * is full.
+ */
+static LCD_DListHeader *LCD_DListAppend(LCD_DList *list, uint8_t type, int16_t x, int16_t y,
+                                        uint16_t w, uint16_t h, uint32_t payload_bytes) {
+    uint32_t words = LCD_DLIST_HEADER_WORDS + (payload_bytes + 3) / 4;
+    LCD_DListHeader *header;
+    
+    if (words > 0xFFFF || list->used + words > LCD_DLIST_WORDS)
+        return 0;
+    header = (LCD_DListHeader *)&list->buffer[list->used];
+    header->type = type;
+    header->reserved = 0;
+    header->words = words;
+    header->x = x;
+    header->y = y;
+    header->w = w;
+    header->h = h;
+    list->used += words;
+    return header;
+}
+
+void LCD_DListReset(LCD_DList *list) {
+    /* The list may still be replaying */
+    if (list == LCD_DListCurrent)
+        LCD_DListWait();
+    list->used = 0;
+}
+
+uint8_t LCD_DListFill(LCD_DList *list, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    LCD_DListHeader *header;
+    
+    if (!LCD_DListClip(&x, &y, &w, &h))
+        return 1;
+    header = LCD_DListAppend(list, LCD_DLIST_FILL, x, y, w, h, sizeof(uint32_t));
+    if (header == 0)
+        return 0;
+    *(uint32_t *)(header + 1) = color;
+    return 1;
+}
+
+/*
+ * The image is not copied, it has to stay valid until the list is done.
+ */
+uint8_t LCD_DListBitmap(LCD_DList *list, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                        const uint16_t *bitmap, uint16_t stride) {
+    LCD_DListHeader *header;
+    LCD_DListBitmapPayload *payload;
+    int16_t clip_x = x, clip_y = y;
+    
+    if (!LCD_DListClip(&clip_x, &clip_y, &w, &h))
+        return 1;
+    header = LCD_DListAppend(list, LCD_DLIST_BITMAP, clip_x, clip_y, w, h, sizeof(LCD_DListBitmapPayload));
+    if (header == 0)
+        return 0;
+    payload = (LCD_DListBitmapPayload *)(header + 1);
+    payload->bitmap = bitmap + (int32_t)(clip_y - y) * stride + (clip_x - x);
+    payload->stride = stride;
+    return 1;
+}
+
+/*
+ * Reserve an on-screen window of w*h pixels in the list. Returns the pixel
+ * buffer to fill row by row, or 0 if the list is full or the window is not
+ * completely on the screen.
+ */
+uint16_t *LCD_DListWindow(LCD_DList *list, int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    LCD_DListHeader *header;
+    
+    if (x < 0 || y < 0 || w == 0 || h == 0 ||
+        x + w > LCD_PIXEL_WIDTH || y + h > LCD_PIXEL_HEIGHT)
+        return 0;
+    header = LCD_DListAppend(list, LCD_DLIST_WINDOW, x, y, w, h, (uint32_t)w * h * 2);
+    if (header == 0)
+        return 0;
+    return (uint16_t *)(header + 1);
+}
+
+/*
+ * Expand "count" characters into "pixel" as a count*cell_w wide image in
+ * the current colors.
+ */
+static void LCD_DListRenderText(uint16_t *pixel, const char *chars, uint16_t count,
+                                const LCD_Font *font, uint8_t scale) {
+    uint8_t row_bytes = (font->width + 7) / 8;
+    const uint8_t *row;
+    uint16_t index, line, color;
+    uint8_t code, col, bits = 0, repeat, line_repeat;
+    
+    for (line = 0; line < font->height; line++) {
+        for (line_repeat = scale; line_repeat != 0; line_repeat--) {
+            for (index = 0; index < count; index++) {
+                code = (uint8_t)chars[index];
+                if (code < font->first || code > font->last)
+                    code = font->first;
+                row = font->data + ((uint32_t)(code - font->first) * font->height + line) * row_bytes;
+                for (col = 0; col < font->width; col++) {
+                    if ((col & 7) == 0)
+                        bits = *row++;
+                    color = (bits & 0x80) ? TextColor : BackColor;
+                    bits <<= 1;
+                    for (repeat = scale; repeat != 0; repeat--)
+                        *pixel++ = color;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Text run with the current font, asciisize and colors. Characters that do
+ * not fit on the screen are dropped like in LCD_DrawString(). The run is
+ * expanded into the list as a pixel window here, so replaying it from the
+ * DMA interrupt only starts a transfer.
+ */
+uint8_t LCD_DListText(LCD_DList *list, int16_t x, int16_t y, const char *text) {
+    const LCD_Font *font = LCD_GetFont();
+    uint8_t scale = asciisize / font->height ? asciisize / font->height : 1;
+    uint16_t cell_w = font->width * scale;
+    uint16_t cell_h = font->height * scale;
+    uint16_t *pixels;
+    uint16_t count;
+    
+    while (x < 0 && *text) {
+        x += cell_w;
+        text++;
+    }
+    if (y < 0 || y + cell_h > LCD_PIXEL_HEIGHT || x >= LCD_PIXEL_WIDTH)
+        return 1;
+    for (count = 0; text[count] && x + (count + 1) * cell_w <= LCD_PIXEL_WIDTH; count++);
+    if (count == 0)
+        return 1;
+    
+    pixels = LCD_DListWindow(list, x, y, count * cell_w, cell_h);
+    if (pixels == 0)
+        return 0;
+    LCD_DListRenderText(pixels, text, count, font, scale);
+    return 1;
+}
+
+/*
+ * Start the next command. Runs from the DMA interrupt as the completion
+ * callback of the previous command.
+ */
+static void LCD_DListNext(void) {
+    const LCD_DListHeader *header;
+    const LCD_DListBitmapPayload *bitmap;
+    LCD_DMACallback callback;
+    
+    while (LCD_DListPosition < LCD_DListCurrent->used) {
+        header = (const LCD_DListHeader *)&LCD_DListCurrent->buffer[LCD_DListPosition];
+        
+        switch (header->type) {
+        case LCD_DLIST_FILL:
+            LCD_DListPosition += header->words;
+            LCD_SetWindow(header->x, header->y, header->w, header->h);
+            LCD_FillDMA(*(const uint32_t *)(header + 1), (uint32_t)header->w * header->h, LCD_DListNext);
+            return;
+        
+        case LCD_DLIST_BITMAP:
+            LCD_DListPosition += header->words;
+            bitmap = (const LCD_DListBitmapPayload *)(header + 1);
+            LCD_DrawBitmapAsync(header->x, header->y, header->w, header->h,
+                                bitmap->bitmap, bitmap->stride, LCD_DListNext);
+            return;
+        
+        case LCD_DLIST_WINDOW:
+            LCD_DListPosition += header->words;
+            LCD_SetWindow(header->x, header->y, header->w, header->h);
+            LCD_WriteDMA((const uint16_t *)(header + 1), (uint32_t)header->w * header->h, LCD_DListNext);
+            return;
+        
+        default:
+            LCD_DListPosition += header->words;
+            break;
+        }
+    }
+    
+    callback = LCD_DListDone;
+    LCD_DListCurrent = 0;
+    LCD_DListDone = 0;
+    LCD_DListActive = 0;
+    if (callback)
+        callback();
+}
+
+/*
+ * Replay "list" in the background. Waits for the previous list first.
+ * "callback" (may be 0) runs from the DMA interrupt when the list is done.
+ */
+void LCD_DListSubmit(LCD_DList *list, LCD_DMACallback callback) {
+    LCD_DListWait();
+    LCD_WaitDMA();
+    
+    LCD_DListCurrent = list;
+    LCD_DListPosition = 0;
+    LCD_DListDone = callback;
+    LCD_DListActive = 1;
+    LCD_DListNext();
+}
+
+uint8_t LCD_DListBusy(void) {
+    return LCD_DListActive;
+}
+
+void LCD_DListWait(void) {
+    while (LCD_DListActive);
+}
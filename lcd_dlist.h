@@ -0,0 +1,41 @@
+/*
+ * Display lists: drawing commands are recorded into a RAM buffer and
+ * replayed in the background, each command started from the DMA transfer
+ * complete interrupt of the previous one.
+ *
+ * With two lists the application records frame N+1 while frame N is still
+ * going out to the panel. Do not call the direct LCD_ drawing functions
+ * while a list is replaying, wait for it with LCD_DListWait() first.
+ *
+ * The DMA reads windows and text runs from the list itself and bitmaps from
+ * where they are, so lists and bitmaps must be in DMA-reachable SRAM, not
+ * in CCM RAM. Text is expanded into the list when it is recorded and takes
+ * two bytes per pixel of the run.
+ */
+
+#ifndef __LCD_DLIST_H
+#define __LCD_DLIST_H
+
+#include "SSD1289.h"
+
+#ifndef LCD_DLIST_WORDS
+#define LCD_DLIST_WORDS          3072
+#endif
+
+typedef struct {
+    uint32_t buffer[LCD_DLIST_WORDS];
+    uint32_t used;                      /* words */
+} LCD_DList;
+
+void LCD_DListReset(LCD_DList *list);
+uint8_t LCD_DListFill(LCD_DList *list, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+uint8_t LCD_DListBitmap(LCD_DList *list, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                        const uint16_t *bitmap, uint16_t stride);
+uint8_t LCD_DListText(LCD_DList *list, int16_t x, int16_t y, const char *text);
+uint16_t *LCD_DListWindow(LCD_DList *list, int16_t x, int16_t y, uint16_t w, uint16_t h);
+
+void LCD_DListSubmit(LCD_DList *list, LCD_DMACallback callback);
+uint8_t LCD_DListBusy(void);
+void LCD_DListWait(void);
+
+#endif /* __LCD_DLIST_H */
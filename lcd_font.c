@@ -0,0 +1,1736 @@
+/*
+ * Fonts for the text functions in SSD1289.c.
+ *
+ * 1bpp glyph rows are packed MSB first (leftmost pixel in bit 7), one byte
+ * per row for fonts up to 8 pixels wide. 4bpp rows hold two pixels per
+ * byte, left pixel in the high nibble. Glyphs follow each other in
+ * character order.
+ */
+
+#include "SSD1289.h"
+
+/* 5x8 glyphs (lower case descenders use the last row) in a 6x8 cell */
+static const uint8_t LCD_Font6x8Data[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   /* 0x20 ' ' */
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00,   /* 0x21 '!' */
+    0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,   /* 0x22 '"' */
+    0x50, 0x50, 0xF8, 0x50, 0xF8, 0x50, 0x50, 0x00,   /* 0x23 '#' */
+    0x20, 0x78, 0xA0, 0x70, 0x28, 0xF0, 0x20, 0x00,   /* 0x24 '$' */
+    0xC0, 0xC8, 0x10, 0x20, 0x40, 0x98, 0x18, 0x00,   /* 0x25 '%' */
+    0x40, 0xA0, 0xA0, 0x40, 0xA8, 0x90, 0x68, 0x00,   /* 0x26 '&' */
+    0x30, 0x30, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,   /* 0x27 quote */
+    0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00,   /* 0x28 '(' */
+    0x40, 0x20, 0x10, 0x10, 0x10, 0x20, 0x40, 0x00,   /* 0x29 ')' */
+    0x20, 0xA8, 0x70, 0xF8, 0x70, 0xA8, 0x20, 0x00,   /* 0x2A '*' */
+    0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, 0x00,   /* 0x2B '+' */
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x20, 0x40,   /* 0x2C ',' */
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,   /* 0x2D '-' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,   /* 0x2E '.' */
+    0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00,   /* 0x2F '/' */
+    0x70, 0x88, 0x98, 0xA8, 0xC8, 0x88, 0x70, 0x00,   /* 0x30 '0' */
+    0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,   /* 0x31 '1' */
+    0x70, 0x88, 0x08, 0x70, 0x80, 0x80, 0xF8, 0x00,   /* 0x32 '2' */
+    0xF8, 0x08, 0x10, 0x30, 0x08, 0x88, 0x70, 0x00,   /* 0x33 '3' */
+    0x10, 0x30, 0x50, 0x90, 0xF8, 0x10, 0x10, 0x00,   /* 0x34 '4' */
+    0xF8, 0x80, 0xF0, 0x08, 0x08, 0x88, 0x70, 0x00,   /* 0x35 '5' */
+    0x38, 0x40, 0x80, 0xF0, 0x88, 0x88, 0x70, 0x00,   /* 0x36 '6' */
+    0xF8, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00,   /* 0x37 '7' */
+    0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70, 0x00,   /* 0x38 '8' */
+    0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0xE0, 0x00,   /* 0x39 '9' */
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,   /* 0x3A ':' */
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x40, 0x00,   /* 0x3B ';' */
+    0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x00,   /* 0x3C '<' */
+    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00,   /* 0x3D '=' */
+    0x40, 0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00,   /* 0x3E '>' */
+    0x70, 0x88, 0x08, 0x30, 0x20, 0x00, 0x20, 0x00,   /* 0x3F '?' */
+    0x70, 0x88, 0xA8, 0xB8, 0xB0, 0x80, 0x78, 0x00,   /* 0x40 '@' */
+    0x20, 0x50, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x00,   /* 0x41 'A' */
+    0xF0, 0x88, 0x88, 0xF0, 0x88, 0x88, 0xF0, 0x00,   /* 0x42 'B' */
+    0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00,   /* 0x43 'C' */
+    0xF0, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF0, 0x00,   /* 0x44 'D' */
+    0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0xF8, 0x00,   /* 0x45 'E' */
+    0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x00,   /* 0x46 'F' */
+    0x78, 0x88, 0x80, 0x80, 0x98, 0x88, 0x78, 0x00,   /* 0x47 'G' */
+    0x88, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0x00,   /* 0x48 'H' */
+    0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,   /* 0x49 'I' */
+    0x38, 0x10, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00,   /* 0x4A 'J' */
+    0x88, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x88, 0x00,   /* 0x4B 'K' */
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x00,   /* 0x4C 'L' */
+    0x88, 0xD8, 0xA8, 0xA8, 0xA8, 0x88, 0x88, 0x00,   /* 0x4D 'M' */
+    0x88, 0x88, 0xC8, 0xA8, 0x98, 0x88, 0x88, 0x00,   /* 0x4E 'N' */
+    0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,   /* 0x4F 'O' */
+    0xF0, 0x88, 0x88, 0xF0, 0x80, 0x80, 0x80, 0x00,   /* 0x50 'P' */
+    0x70, 0x88, 0x88, 0x88, 0xA8, 0x90, 0x68, 0x00,   /* 0x51 'Q' */
+    0xF0, 0x88, 0x88, 0xF0, 0xA0, 0x90, 0x88, 0x00,   /* 0x52 'R' */
+    0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70, 0x00,   /* 0x53 'S' */
+    0xF8, 0xA8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,   /* 0x54 'T' */
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,   /* 0x55 'U' */
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00,   /* 0x56 'V' */
+    0x88, 0x88, 0x88, 0xA8, 0xA8, 0xA8, 0x50, 0x00,   /* 0x57 'W' */
+    0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x00,   /* 0x58 'X' */
+    0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20, 0x00,   /* 0x59 'Y' */
+    0xF8, 0x08, 0x10, 0x70, 0x40, 0x80, 0xF8, 0x00,   /* 0x5A 'Z' */
+    0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x78, 0x00,   /* 0x5B '[' */
+    0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00,   /* 0x5C backslash */
+    0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00,   /* 0x5D ']' */
+    0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,   /* 0x5E '^' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,   /* 0x5F '_' */
+    0x60, 0x60, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00,   /* 0x60 '`' */
+    0x00, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,   /* 0x61 'a' */
+    0x80, 0x80, 0xB0, 0xC8, 0x88, 0xC8, 0xB0, 0x00,   /* 0x62 'b' */
+    0x00, 0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x00,   /* 0x63 'c' */
+    0x08, 0x08, 0x68, 0x98, 0x88, 0x98, 0x68, 0x00,   /* 0x64 'd' */
+    0x00, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x70, 0x00,   /* 0x65 'e' */
+    0x10, 0x28, 0x20, 0x70, 0x20, 0x20, 0x20, 0x00,   /* 0x66 'f' */
+    0x00, 0x00, 0x70, 0x98, 0x98, 0x68, 0x08, 0x70,   /* 0x67 'g' */
+    0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00,   /* 0x68 'h' */
+    0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00,   /* 0x69 'i' */
+    0x10, 0x00, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00,   /* 0x6A 'j' */
+    0x80, 0x80, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x00,   /* 0x6B 'k' */
+    0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,   /* 0x6C 'l' */
+    0x00, 0x00, 0xD0, 0xA8, 0xA8, 0xA8, 0xA8, 0x00,   /* 0x6D 'm' */
+    0x00, 0x00, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00,   /* 0x6E 'n' */
+    0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00,   /* 0x6F 'o' */
+    0x00, 0x00, 0xB0, 0xC8, 0xC8, 0xB0, 0x80, 0x80,   /* 0x70 'p' */
+    0x00, 0x00, 0x68, 0x98, 0x98, 0x68, 0x08, 0x08,   /* 0x71 'q' */
+    0x00, 0x00, 0xB0, 0xC8, 0x80, 0x80, 0x80, 0x00,   /* 0x72 'r' */
+    0x00, 0x00, 0x78, 0x80, 0x70, 0x08, 0xF0, 0x00,   /* 0x73 's' */
+    0x20, 0x20, 0xF8, 0x20, 0x20, 0x28, 0x10, 0x00,   /* 0x74 't' */
+    0x00, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00,   /* 0x75 'u' */
+    0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00,   /* 0x76 'v' */
+    0x00, 0x00, 0x88, 0x88, 0xA8, 0xA8, 0x50, 0x00,   /* 0x77 'w' */
+    0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00,   /* 0x78 'x' */
+    0x00, 0x00, 0x88, 0x88, 0x78, 0x08, 0x88, 0x70,   /* 0x79 'y' */
+    0x00, 0x00, 0xF8, 0x10, 0x20, 0x40, 0xF8, 0x00,   /* 0x7A 'z' */
+    0x10, 0x20, 0x20, 0x40, 0x20, 0x20, 0x10, 0x00,   /* 0x7B '{' */
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00,   /* 0x7C '|' */
+    0x40, 0x20, 0x20, 0x10, 0x20, 0x20, 0x40, 0x00,   /* 0x7D '}' */
+    0x40, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,   /* 0x7E '~' */
+};
+
+const LCD_Font LCD_Font6x8 = { 6, 8, 0x20, 0x7E, LCD_Font6x8Data };
+
+/*
+ * 12x16 anti-aliased glyphs, 4bpp coverage (0 = BackColor, 15 = TextColor),
+ * derived from LCD_Font6x8 by scale2x smoothing to 8x size and 4x4 box
+ * filtering.
+ */
+static const uint8_t LCD_FontAA12x16Data[] = {
+    /* 0x20 ' ' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x21 '!' */
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x22 '"' */
+    0x00, 0xBB, 0x00, 0xBB, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xBB, 0x00, 0xBB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x23 '#' */
+    0x00, 0xBB, 0x00, 0xBB, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+    0x04, 0xFF, 0x00, 0xFF, 0x40, 0x00,
+    0x3D, 0xFF, 0x55, 0xFF, 0xD3, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x05, 0xFF, 0x55, 0xFF, 0x50, 0x00,
+    0x05, 0xFF, 0x55, 0xFF, 0x50, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x3D, 0xFF, 0x55, 0xFF, 0xD3, 0x00,
+    0x04, 0xFF, 0x00, 0xFF, 0x40, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xBB, 0x00, 0xBB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x24 '$' */
+    0x00, 0x03, 0xCC, 0x30, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD4, 0x00, 0x00,
+    0x03, 0xDF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xCF, 0x55, 0xFF, 0x50, 0x00, 0x00,
+    0xCF, 0x55, 0xFF, 0x50, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x00, 0x05, 0xFF, 0x55, 0xFC, 0x00,
+    0x00, 0x05, 0xFF, 0x55, 0xFC, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFD, 0x30, 0x00,
+    0x00, 0x4D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x03, 0xCC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x25 '%' */
+    0x3C, 0xC3, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFC, 0x00, 0x03, 0xCB, 0x00,
+    0x3C, 0xC3, 0x00, 0x3D, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0xDF, 0xD3, 0x00,
+    0x00, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x03, 0xDF, 0xD3, 0x00, 0x00, 0x00,
+    0x3D, 0xFD, 0x30, 0x00, 0x00, 0x00,
+    0xCF, 0xD3, 0x00, 0x3C, 0xC3, 0x00,
+    0xBC, 0x30, 0x00, 0xCF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x3C, 0xC3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x26 '&' */
+    0x03, 0xCC, 0x30, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xD3, 0x00, 0x00, 0x00,
+    0xCF, 0x55, 0xFC, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xBA, 0x66, 0xAB, 0x00, 0x00, 0x00,
+    0x06, 0xAA, 0x60, 0x00, 0x00, 0x00,
+    0x06, 0xAA, 0x60, 0x00, 0x00, 0x00,
+    0xBA, 0x66, 0xAB, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0xBA, 0x66, 0xAB, 0x00,
+    0xFF, 0x40, 0x06, 0xAA, 0x60, 0x00,
+    0xCF, 0xD4, 0x06, 0xAA, 0x60, 0x00,
+    0x3D, 0xFF, 0xFA, 0x66, 0xAB, 0x00,
+    0x03, 0xCF, 0xFB, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x27 ''' */
+    0x00, 0x00, 0x3C, 0xC3, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0xBC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x28 '(' */
+    0x00, 0x00, 0x03, 0xCB, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFC, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xCB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x29 ')' */
+    0x00, 0xBC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFC, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0xBC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2A '*' */
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0xFF, 0x00, 0xBB, 0x00,
+    0xBB, 0x04, 0xFF, 0x40, 0xBB, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x04, 0xDF, 0xFF, 0xFD, 0x40, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x04, 0xDF, 0xFF, 0xFD, 0x40, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0xBB, 0x04, 0xFF, 0x40, 0xBB, 0x00,
+    0xBB, 0x00, 0xFF, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2B '+' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x4D, 0xFF, 0xD4, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x4D, 0xFF, 0xD4, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2C ',' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0xC3, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0xBC, 0x30, 0x00, 0x00, 0x00,
+    /* 0x2D '-' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2E '.' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0xC3, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0xC3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2F '/' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xCB, 0x00,
+    0x00, 0x00, 0x00, 0x3D, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0xDF, 0xD3, 0x00,
+    0x00, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x03, 0xDF, 0xD3, 0x00, 0x00, 0x00,
+    0x3D, 0xFD, 0x30, 0x00, 0x00, 0x00,
+    0xCF, 0xD3, 0x00, 0x00, 0x00, 0x00,
+    0xBC, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x30 '0' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x05, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x05, 0xFF, 0x00,
+    0xFF, 0x00, 0x03, 0xCF, 0xFF, 0x00,
+    0xFF, 0x00, 0x3D, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0xCF, 0x55, 0xFF, 0x00,
+    0xFF, 0x55, 0xFC, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0xD3, 0x00, 0xFF, 0x00,
+    0xFF, 0xFC, 0x30, 0x00, 0xFF, 0x00,
+    0xFF, 0x50, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0x50, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x31 '1' */
+    0x00, 0x03, 0xCB, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x32 '2' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xBC, 0x30, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFC, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0xCF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x33 '3' */
+    0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0xCF, 0xD3, 0x00,
+    0x00, 0x00, 0x3D, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0xCF, 0xFA, 0x60, 0x00,
+    0x00, 0x00, 0xBF, 0xA2, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0x00,
+    0xBC, 0x30, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x34 '4' */
+    0x00, 0x00, 0x03, 0xCB, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFF, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xFF, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xFF, 0x00, 0x00,
+    0x03, 0xDF, 0x55, 0xFF, 0x00, 0x00,
+    0x3D, 0xFB, 0x00, 0xFF, 0x00, 0x00,
+    0xCF, 0x50, 0x04, 0xFF, 0x40, 0x00,
+    0xFF, 0x50, 0x4D, 0xFF, 0xD3, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x4D, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x35 '5' */
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xBC, 0x30, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x36 '6' */
+    0x00, 0x03, 0xCF, 0xFF, 0xFB, 0x00,
+    0x00, 0x3D, 0xFF, 0xFF, 0xFB, 0x00,
+    0x03, 0xDF, 0xD4, 0x00, 0x00, 0x00,
+    0x3D, 0xFC, 0x30, 0x00, 0x00, 0x00,
+    0xCF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x37 '7' */
+    0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x3D, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0xDF, 0xD3, 0x00,
+    0x00, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x03, 0xDF, 0xD3, 0x00, 0x00, 0x00,
+    0x3D, 0xFD, 0x30, 0x00, 0x00, 0x00,
+    0xCF, 0xD3, 0x00, 0x00, 0x00, 0x00,
+    0xBC, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x38 '8' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xBF, 0xD4, 0x00, 0x4D, 0xFB, 0x00,
+    0x05, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+    0x05, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+    0xBF, 0xD4, 0x00, 0x4D, 0xFB, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x39 '9' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFF, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0xCF, 0xD3, 0x00,
+    0x00, 0x00, 0x4D, 0xFD, 0x30, 0x00,
+    0xBF, 0xFF, 0xFF, 0xD3, 0x00, 0x00,
+    0xBF, 0xFF, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x3A ':' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x3B ';' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0xBC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x3C '<' */
+    0x00, 0x00, 0x00, 0x03, 0xCB, 0x00,
+    0x00, 0x00, 0x00, 0x3D, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0xDF, 0xD3, 0x00,
+    0x00, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x3D, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0xCF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0x00, 0x00, 0x03, 0xDF, 0xD3, 0x00,
+    0x00, 0x00, 0x00, 0x3D, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xCB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x3D '=' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x3E '>' */
+    0x00, 0xBC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0x00, 0x00, 0x03, 0xCF, 0xD3, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0xCF, 0xD3, 0x00,
+    0x00, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0xBC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x3F '?' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xBC, 0x30, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFC, 0x00,
+    0x00, 0x00, 0x3C, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0xCF, 0xFD, 0x30, 0x00,
+    0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0xBC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x40 '@' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0xBB, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x55, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
+    0xFF, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0xFF, 0x00, 0x3C, 0xC4, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x41 'A' */
+    0x00, 0x03, 0xCC, 0x30, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x03, 0xDF, 0x55, 0xFD, 0x30, 0x00,
+    0x3D, 0xFC, 0x00, 0xCF, 0xD3, 0x00,
+    0xCF, 0xD3, 0x00, 0x3D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x42 'B' */
+    0x3C, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFB, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFB, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x43 'C' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x03, 0xCB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x03, 0xCB, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x44 'D' */
+    0x3C, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x45 'E' */
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x46 'F' */
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x47 'G' */
+    0x03, 0xCF, 0xFF, 0xFF, 0xC3, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x03, 0xCB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xBF, 0xC3, 0x00,
+    0xFF, 0x00, 0x00, 0xBF, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x05, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x05, 0xFF, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xC3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x48 'H' */
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x49 'I' */
+    0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x4A 'J' */
+    0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x3D, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xBC, 0x30, 0x04, 0xFF, 0x00, 0x00,
+    0xCF, 0xD4, 0x4D, 0xFC, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xD3, 0x00, 0x00,
+    0x03, 0xCF, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x4B 'K' */
+    0xBB, 0x00, 0x00, 0x03, 0xCB, 0x00,
+    0xFF, 0x00, 0x00, 0x3D, 0xFC, 0x00,
+    0xFF, 0x00, 0x03, 0xDF, 0xD3, 0x00,
+    0xFF, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0xFF, 0x00, 0xCF, 0xD3, 0x00, 0x00,
+    0xFF, 0x56, 0xAC, 0x30, 0x00, 0x00,
+    0xFF, 0xFA, 0x60, 0x00, 0x00, 0x00,
+    0xFF, 0xFA, 0x60, 0x00, 0x00, 0x00,
+    0xFF, 0x56, 0xAC, 0x30, 0x00, 0x00,
+    0xFF, 0x00, 0xCF, 0xD3, 0x00, 0x00,
+    0xFF, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0xFF, 0x00, 0x03, 0xDF, 0xD3, 0x00,
+    0xFF, 0x00, 0x00, 0x3D, 0xFC, 0x00,
+    0xBB, 0x00, 0x00, 0x03, 0xCB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x4C 'L' */
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x4D 'M' */
+    0xBC, 0x30, 0x00, 0x03, 0xCB, 0x00,
+    0xFF, 0xD3, 0x00, 0x3D, 0xFF, 0x00,
+    0xFF, 0xFC, 0x00, 0xCF, 0xFF, 0x00,
+    0xFF, 0xFA, 0x66, 0xAF, 0xFF, 0x00,
+    0xFF, 0x56, 0xAA, 0x65, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xBB, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x4E 'N' */
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0xD3, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0xFD, 0x30, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0xD3, 0x00, 0xFF, 0x00,
+    0xFF, 0x55, 0xFC, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xCF, 0x55, 0xFF, 0x00,
+    0xFF, 0x00, 0x3D, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x03, 0xDF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x3D, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x4F 'O' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x50 'P' */
+    0x3C, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x51 'Q' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xBB, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xBA, 0x66, 0xAB, 0x00,
+    0xFF, 0x40, 0x06, 0xAA, 0x60, 0x00,
+    0xCF, 0xD4, 0x06, 0xAA, 0x60, 0x00,
+    0x3D, 0xFF, 0xFA, 0x66, 0xAB, 0x00,
+    0x03, 0xCF, 0xFB, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x52 'R' */
+    0x3C, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0xFF, 0x55, 0xFF, 0x50, 0x00, 0x00,
+    0xFF, 0x00, 0xCF, 0x50, 0x00, 0x00,
+    0xFF, 0x00, 0x3D, 0xFC, 0x30, 0x00,
+    0xFF, 0x00, 0x03, 0xDF, 0xD3, 0x00,
+    0xFF, 0x00, 0x00, 0x3D, 0xFC, 0x00,
+    0xBB, 0x00, 0x00, 0x03, 0xCB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x53 'S' */
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x03, 0xCB, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0xBC, 0x30, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x54 'T' */
+    0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0xFF, 0x55, 0xFF, 0x55, 0xFF, 0x00,
+    0xBB, 0x00, 0xFF, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x55 'U' */
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x56 'V' */
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD3, 0x00, 0x3D, 0xFC, 0x00,
+    0x3D, 0xFC, 0x00, 0xCF, 0xD3, 0x00,
+    0x03, 0xDF, 0x55, 0xFD, 0x30, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x03, 0xCC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x57 'W' */
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xBB, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xCF, 0x56, 0xAA, 0x65, 0xFC, 0x00,
+    0x3D, 0xFA, 0x66, 0xAF, 0xD3, 0x00,
+    0x03, 0xCB, 0x00, 0xBC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x58 'X' */
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD3, 0x00, 0x3D, 0xFC, 0x00,
+    0x3D, 0xFC, 0x00, 0xCF, 0xD3, 0x00,
+    0x03, 0xCA, 0x66, 0xAC, 0x30, 0x00,
+    0x00, 0x06, 0xAA, 0x60, 0x00, 0x00,
+    0x00, 0x06, 0xAA, 0x60, 0x00, 0x00,
+    0x03, 0xCA, 0x66, 0xAC, 0x30, 0x00,
+    0x3D, 0xFC, 0x00, 0xCF, 0xD3, 0x00,
+    0xCF, 0xD3, 0x00, 0x3D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x59 'Y' */
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD3, 0x00, 0x3D, 0xFC, 0x00,
+    0x3D, 0xFC, 0x00, 0xCF, 0xD3, 0x00,
+    0x03, 0xDF, 0x55, 0xFD, 0x30, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x5A 'Z' */
+    0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0xCF, 0xD3, 0x00,
+    0x00, 0x00, 0x4D, 0xFF, 0x40, 0x00,
+    0x00, 0x3C, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xC3, 0x00, 0x00,
+    0x04, 0xFF, 0xD4, 0x00, 0x00, 0x00,
+    0x3D, 0xFC, 0x30, 0x00, 0x00, 0x00,
+    0xCF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x5B '[' */
+    0x00, 0x3C, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0xCF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0xFF, 0xD4, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xD4, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x3C, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x5C backslash */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBC, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xD3, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFD, 0x30, 0x00, 0x00, 0x00,
+    0x03, 0xDF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFD, 0x30, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFD, 0x30, 0x00,
+    0x00, 0x00, 0x03, 0xDF, 0xD3, 0x00,
+    0x00, 0x00, 0x00, 0x3D, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xCB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x5D ']' */
+    0x00, 0xBF, 0xFF, 0xFF, 0xC3, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFF, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xC3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x5E '^' */
+    0x00, 0x03, 0xCC, 0x30, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x03, 0xDF, 0x55, 0xFD, 0x30, 0x00,
+    0x3D, 0xFC, 0x00, 0xCF, 0xD3, 0x00,
+    0xCF, 0xD3, 0x00, 0x3D, 0xFC, 0x00,
+    0xBC, 0x30, 0x00, 0x03, 0xCB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x5F '_' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x60 '`' */
+    0x00, 0x3C, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x03, 0xDF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xCB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x61 'a' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0x00, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0xCF, 0x50, 0x05, 0xFF, 0x40, 0x00,
+    0xCF, 0x50, 0x05, 0xFF, 0xD3, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x62 'b' */
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xBF, 0xFC, 0x30, 0x00,
+    0xFF, 0x55, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xFF, 0xD4, 0x4D, 0xFC, 0x00,
+    0xFF, 0xFC, 0x30, 0x04, 0xFF, 0x00,
+    0xFF, 0x50, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x50, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0xFC, 0x30, 0x04, 0xFF, 0x00,
+    0xFF, 0xFF, 0xD4, 0x4D, 0xFC, 0x00,
+    0xFF, 0x55, 0xFF, 0xFF, 0xD3, 0x00,
+    0xBB, 0x00, 0xBF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x63 'c' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x03, 0xCB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x03, 0xCB, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x64 'd' */
+    0x00, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x03, 0xCF, 0xFB, 0x00, 0xFF, 0x00,
+    0x3D, 0xFF, 0xFF, 0x55, 0xFF, 0x00,
+    0xCF, 0xD4, 0x4D, 0xFF, 0xFF, 0x00,
+    0xFF, 0x40, 0x03, 0xCF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00,
+    0xFF, 0x40, 0x03, 0xCF, 0xFF, 0x00,
+    0xCF, 0xD4, 0x4D, 0xFF, 0xFF, 0x00,
+    0x3D, 0xFF, 0xFF, 0x55, 0xFF, 0x00,
+    0x03, 0xCF, 0xFB, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x65 'e' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0x50, 0x00, 0x05, 0xFC, 0x00,
+    0xFF, 0x50, 0x00, 0x05, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x03, 0xCF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x66 'f' */
+    0x00, 0x00, 0x03, 0xCC, 0x30, 0x00,
+    0x00, 0x00, 0x3D, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0xCF, 0x55, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0xBB, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x67 'g' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xFF, 0xC4, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+    0xCF, 0xD4, 0x4D, 0xFF, 0xF4, 0x00,
+    0xFF, 0x40, 0x04, 0xFF, 0xFC, 0x00,
+    0xFF, 0x40, 0x06, 0xAF, 0xFF, 0x00,
+    0xCF, 0xD4, 0x5F, 0x1C, 0xFF, 0x00,
+    0x3D, 0xFF, 0xFF, 0x04, 0xFF, 0x00,
+    0x03, 0xCF, 0xFB, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFC, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x00, 0xBF, 0xFF, 0xFC, 0x30, 0x00,
+    /* 0x68 'h' */
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xBF, 0xFC, 0x30, 0x00,
+    0xFF, 0x55, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xFF, 0xD4, 0x4D, 0xFC, 0x00,
+    0xFF, 0xFD, 0x30, 0x04, 0xFF, 0x00,
+    0xFF, 0xD3, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x69 'i' */
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x6A 'j' */
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xBC, 0x30, 0x04, 0xFF, 0x00, 0x00,
+    0xCF, 0xD4, 0x4D, 0xFC, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xD3, 0x00, 0x00,
+    0x03, 0xCF, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x6B 'k' */
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x03, 0xCB, 0x00, 0x00,
+    0xFF, 0x00, 0x3D, 0xFC, 0x00, 0x00,
+    0xFF, 0x00, 0xCF, 0xD3, 0x00, 0x00,
+    0xFF, 0x56, 0xAC, 0x30, 0x00, 0x00,
+    0xFF, 0xFA, 0x60, 0x00, 0x00, 0x00,
+    0xFF, 0xFA, 0x60, 0x00, 0x00, 0x00,
+    0xFF, 0x56, 0xAC, 0x30, 0x00, 0x00,
+    0xFF, 0x00, 0xCF, 0xD3, 0x00, 0x00,
+    0xFF, 0x00, 0x3D, 0xFC, 0x00, 0x00,
+    0xBB, 0x00, 0x03, 0xCB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x6C 'l' */
+    0x00, 0xBF, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x6D 'm' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3C, 0xFB, 0x00, 0xBC, 0x30, 0x00,
+    0xCF, 0xFA, 0x66, 0xAF, 0xD3, 0x00,
+    0xFF, 0x56, 0xAA, 0x65, 0xFC, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x6E 'n' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0xBF, 0xFC, 0x30, 0x00,
+    0xFF, 0x55, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xFF, 0xD4, 0x4D, 0xFC, 0x00,
+    0xFF, 0xFD, 0x30, 0x04, 0xFF, 0x00,
+    0xFF, 0xD3, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x6F 'o' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x70 'p' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0xBF, 0xFC, 0x30, 0x00,
+    0xFF, 0x40, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xC1, 0xF5, 0x4D, 0xFC, 0x00,
+    0xFF, 0xFA, 0x60, 0x04, 0xFF, 0x00,
+    0xFF, 0xFA, 0x60, 0x04, 0xFF, 0x00,
+    0xFF, 0xC1, 0xF5, 0x4D, 0xFC, 0x00,
+    0xFF, 0x40, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0x00, 0xBF, 0xFC, 0x30, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x71 'q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xFB, 0x00, 0xBB, 0x00,
+    0x3D, 0xFF, 0xFF, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x5F, 0x1C, 0xFF, 0x00,
+    0xFF, 0x40, 0x06, 0xAF, 0xFF, 0x00,
+    0xFF, 0x40, 0x06, 0xAF, 0xFF, 0x00,
+    0xCF, 0xD4, 0x5F, 0x1C, 0xFF, 0x00,
+    0x3D, 0xFF, 0xFF, 0x04, 0xFF, 0x00,
+    0x03, 0xCF, 0xFB, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    /* 0x72 'r' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0xBF, 0xFC, 0x30, 0x00,
+    0xFF, 0x55, 0xFF, 0xFF, 0xD3, 0x00,
+    0xFF, 0xFF, 0xD4, 0x4D, 0xFC, 0x00,
+    0xFF, 0xFD, 0x30, 0x03, 0xCB, 0x00,
+    0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x73 's' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xCF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFC, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x74 't' */
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x4D, 0xFF, 0xD4, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x4D, 0xFF, 0xD4, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0xCF, 0x55, 0xFC, 0x00,
+    0x00, 0x00, 0x3D, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0x03, 0xCC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x75 'u' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x3D, 0xFF, 0x00,
+    0xFF, 0x40, 0x03, 0xDF, 0xFF, 0x00,
+    0xCF, 0xD4, 0x4D, 0xFF, 0xFF, 0x00,
+    0x3D, 0xFF, 0xFF, 0x55, 0xFF, 0x00,
+    0x03, 0xCF, 0xFB, 0x00, 0xBB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x76 'v' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD3, 0x00, 0x3D, 0xFC, 0x00,
+    0x3D, 0xFC, 0x00, 0xCF, 0xD3, 0x00,
+    0x03, 0xDF, 0x55, 0xFD, 0x30, 0x00,
+    0x00, 0x3D, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x03, 0xCC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x77 'w' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xBB, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xCF, 0x56, 0xAA, 0x65, 0xFC, 0x00,
+    0x3D, 0xFA, 0x66, 0xAF, 0xD3, 0x00,
+    0x03, 0xCB, 0x00, 0xBC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x78 'x' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBC, 0x30, 0x00, 0x03, 0xCB, 0x00,
+    0xCF, 0xD3, 0x00, 0x3D, 0xFC, 0x00,
+    0x3D, 0xFC, 0x00, 0xCF, 0xD3, 0x00,
+    0x03, 0xCA, 0x66, 0xAC, 0x30, 0x00,
+    0x00, 0x06, 0xAA, 0x60, 0x00, 0x00,
+    0x00, 0x06, 0xAA, 0x60, 0x00, 0x00,
+    0x03, 0xCA, 0x66, 0xAC, 0x30, 0x00,
+    0x3D, 0xFC, 0x00, 0xCF, 0xD3, 0x00,
+    0xCF, 0xD3, 0x00, 0x3D, 0xFC, 0x00,
+    0xBC, 0x30, 0x00, 0x03, 0xCB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x79 'y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x40, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFF, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x4D, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x00,
+    0xBC, 0x30, 0x00, 0x04, 0xFF, 0x00,
+    0xCF, 0xD4, 0x00, 0x4D, 0xFC, 0x00,
+    0x3D, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+    0x03, 0xCF, 0xFF, 0xFC, 0x30, 0x00,
+    /* 0x7A 'z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0x05, 0xFD, 0x30, 0x00,
+    0x00, 0x03, 0xCF, 0xD3, 0x00, 0x00,
+    0x00, 0x3D, 0xFC, 0x30, 0x00, 0x00,
+    0x03, 0xDF, 0x50, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x7B '{' */
+    0x00, 0x00, 0x03, 0xCB, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x3D, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xCB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x7C '|' */
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x7D '}' */
+    0x00, 0xBC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xD3, 0x00, 0x00, 0x00,
+    0x00, 0xBC, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x7E '~' */
+    0x03, 0xCC, 0x30, 0x00, 0x00, 0x00,
+    0x3D, 0xFF, 0xD3, 0x00, 0x00, 0x00,
+    0xCF, 0x55, 0xFC, 0x00, 0xBB, 0x00,
+    0xBB, 0x00, 0xCF, 0x55, 0xFC, 0x00,
+    0x00, 0x00, 0x3D, 0xFF, 0xD3, 0x00,
+    0x00, 0x00, 0x03, 0xCC, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const LCD_FontAA LCD_FontAA12x16 = { 12, 16, 0x20, 0x7E, LCD_FontAA12x16Data };
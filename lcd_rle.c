@@ -0,0 +1,75 @@
+/*
+ * Run-length coding of RGB565 pixels, see lcd_rle.h for the format.
+ */
+
+#include "lcd_rle.h"
+
+static uint8_t *LCD_RLEPut(uint8_t *out, uint16_t value) {
+    *out++ = (uint8_t)value;
+    *out++ = (uint8_t)(value >> 8);
+    return out;
+}
+
+/*
+ * Encode "count" pixels into "out", which must hold LCD_RLE_MAX_BYTES(count).
+ * Returns the number of bytes written.
+ */
+uint32_t LCD_RLEEncode(const uint16_t *pixels, uint32_t count, uint8_t *out) {
+    uint8_t *start = out;
+    uint32_t index = 0, run, first;
+    
+    while (index < count) {
+        run = 1;
+        while (index + run < count && run < LCD_RLE_MAX_TOKEN && pixels[index + run] == pixels[index])
+            run++;
+        if (run >= LCD_RLE_MIN_RUN) {
+            out = LCD_RLEPut(out, LCD_RLE_RUN | (run - 1));
+            out = LCD_RLEPut(out, pixels[index]);
+            index += run;
+            continue;
+        }
+        
+        /* Literal up to the start of the next run worth coding */
+        first = index;
+        do {
+            index++;
+        } while (index < count && index - first < LCD_RLE_MAX_TOKEN &&
+                 !(index + 2 < count && pixels[index] == pixels[index + 1] &&
+                   pixels[index] == pixels[index + 2]));
+        out = LCD_RLEPut(out, (uint16_t)(index - first - 1));
+        while (first < index)
+            out = LCD_RLEPut(out, pixels[first++]);
+    }
+    return out - start;
+}
+
+/*
+ * Decode the complete tokens in "in" into "out" (room for "space" pixels).
+ * Stores the number of pixels written in "decoded" and returns the number
+ * of bytes used; a token cut off at the end of "in", or one that does not
+ * fit in "out", is left for the next call.
+ */
+uint32_t LCD_RLEDecode(const uint8_t *in, uint32_t length, uint16_t *out, uint32_t space,
+                       uint32_t *decoded) {
+    uint32_t used = 0, written = 0, pixels, bytes, pos;
+    uint16_t header, color;
+    
+    while (used + 2 <= length) {
+        header = in[used] | (in[used + 1] << 8);
+        pixels = (header & ~LCD_RLE_RUN) + 1;
+        bytes = 2 + ((header & LCD_RLE_RUN) ? 2 : 2 * pixels);
+        if (used + bytes > length || written + pixels > space)
+            break;
+        if (header & LCD_RLE_RUN) {
+            color = in[used + 2] | (in[used + 3] << 8);
+            while (pixels--)
+                out[written++] = color;
+        }else{
+            for (pos = used + 2; pixels--; pos += 2)
+                out[written++] = in[pos] | (in[pos + 1] << 8);
+        }
+        used += bytes;
+    }
+    *decoded = written;
+    return used;
+}
@@ -0,0 +1,28 @@
+/*
+ * Run-length coding of RGB565 pixels for sending screen contents over USB.
+ *
+ * The stream is a sequence of tokens, all values little endian. A token
+ * starts with a 16 bit header: bit 15 set is a run of (header & 0x7FFF) + 1
+ * pixels of the one color that follows, bit 15 clear is a literal of
+ * header + 1 pixels that follow one by one. Plain C, shared with the host
+ * tools in host/.
+ */
+
+#ifndef __LCD_RLE_H
+#define __LCD_RLE_H
+
+#include <stdint.h>
+
+#define LCD_RLE_RUN              0x8000
+#define LCD_RLE_MAX_TOKEN        0x8000  /* pixels per token */
+#define LCD_RLE_MIN_RUN          3       /* shorter repeats stay in a literal */
+
+/* Worst case encoded size of "count" pixels: literals, one header per token */
+#define LCD_RLE_MAX_BYTES(count) (2 * (uint32_t)(count) + \
+    2 * (((uint32_t)(count) + LCD_RLE_MAX_TOKEN - 1) / LCD_RLE_MAX_TOKEN))
+
+uint32_t LCD_RLEEncode(const uint16_t *pixels, uint32_t count, uint8_t *out);
+uint32_t LCD_RLEDecode(const uint8_t *in, uint32_t length, uint16_t *out, uint32_t space,
+                       uint32_t *decoded);
+
+#endif /* __LCD_RLE_H */
@@ -0,0 +1,138 @@
+/*
+ * Tile renderer with a dirty tile bitmap.
+ */
+
+#include "lcd_tiles.h"
+
+#define LCD_TILE_WORDS           ((LCD_TILES + 31) / 32)
+
+static LCD_TileRenderCallback LCD_TileRender = 0;
+static uint32_t LCD_TileDirty[LCD_TILE_WORDS];
+
+/* Two buffers: one is rendered while DMA sends the other */
+static uint16_t LCD_TileBuffer[2][LCD_TILE_WIDTH * LCD_TILE_HEIGHT];
+
+void LCD_TilesInit(LCD_TileRenderCallback render) {
+    LCD_TileRender = render;
+    LCD_TilesInvalidateAll();
+}
+
+/*
+ * Mark every tile touched by the screen rectangle [x,y,w,h] as dirty.
+ */
+void LCD_TilesInvalidate(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    int32_t x_end = (int32_t)x + w;
+    int32_t y_end = (int32_t)y + h;
+    uint16_t col, row, col_first, col_last, row_first, row_last, tile;
+    
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x_end > LCD_PIXEL_WIDTH) x_end = LCD_PIXEL_WIDTH;
+    if (y_end > LCD_PIXEL_HEIGHT) y_end = LCD_PIXEL_HEIGHT;
+    if (x_end <= x || y_end <= y)
+        return;
+    
+    col_first = x / LCD_TILE_WIDTH;
+    col_last = (x_end - 1) / LCD_TILE_WIDTH;
+    row_first = y / LCD_TILE_HEIGHT;
+    row_last = (y_end - 1) / LCD_TILE_HEIGHT;
+    for (row = row_first; row <= row_last; row++) {
+        for (col = col_first; col <= col_last; col++) {
+            tile = row * LCD_TILES_X + col;
+            LCD_TileDirty[tile >> 5] |= 1UL << (tile & 31);
+        }
+    }
+}
+
+void LCD_TilesInvalidateAll(void) {
+    uint16_t index;
+    
+    for (index = 0; index < LCD_TILE_WORDS; index++)
+        LCD_TileDirty[index] = 0xFFFFFFFF;
+    /* Keep the bits past the last tile clear */
+    if (LCD_TILES & 31)
+        LCD_TileDirty[LCD_TILE_WORDS - 1] = (1UL << (LCD_TILES & 31)) - 1;
+}
+
+/*
+ * Render and send all dirty tiles. Returns the number of tiles sent.
+ */
+uint16_t LCD_TilesRender(void) {
+    LCD_Tile tile;
+    uint32_t bits;
+    uint16_t word, index, sent = 0;
+    uint8_t buffer = 0;
+    
+    if (LCD_TileRender == 0)
+        return 0;
+    
+    for (word = 0; word < LCD_TILE_WORDS; word++) {
+        bits = LCD_TileDirty[word];
+        LCD_TileDirty[word] = 0;
+        while (bits) {
+            index = (word << 5) + __CLZ(__RBIT(bits));
+            bits &= bits - 1;
+            
+            tile.x = (index % LCD_TILES_X) * LCD_TILE_WIDTH;
+            tile.y = (index / LCD_TILES_X) * LCD_TILE_HEIGHT;
+            tile.w = LCD_PIXEL_WIDTH - tile.x < LCD_TILE_WIDTH ? LCD_PIXEL_WIDTH - tile.x : LCD_TILE_WIDTH;
+            tile.h = LCD_PIXEL_HEIGHT - tile.y < LCD_TILE_HEIGHT ? LCD_PIXEL_HEIGHT - tile.y : LCD_TILE_HEIGHT;
+            tile.pixels = LCD_TileBuffer[buffer];
+            LCD_TileRender(&tile);
+            
+            /* Waits for the previous tile, then sends this one in the background */
+            LCD_DrawBitmapAsync(tile.x, tile.y, tile.w, tile.h, tile.pixels, tile.w, 0);
+            buffer ^= 1;
+            sent++;
+        }
+    }
+    LCD_WaitDMA();
+    return sent;
+}
+
+/*
+ * Fill the part of the screen rectangle [x,y,w,h] that falls in the tile.
+ */
+void LCD_TileFillRect(LCD_Tile *tile, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    int32_t x_end = (int32_t)x + w;
+    int32_t y_end = (int32_t)y + h;
+    uint16_t *row;
+    int32_t col, line;
+    
+    if (x < tile->x) x = tile->x;
+    if (y < tile->y) y = tile->y;
+    if (x_end > tile->x + tile->w) x_end = tile->x + tile->w;
+    if (y_end > tile->y + tile->h) y_end = tile->y + tile->h;
+    if (x >= x_end || y >= y_end)
+        return;
+    
+    row = tile->pixels + (y - tile->y) * tile->w;
+    for (line = y; line < y_end; line++) {
+        for (col = x; col < x_end; col++)
+            row[col - tile->x] = color;
+        row += tile->w;
+    }
+}
+
+/*
+ * Copy the part of a w*h image at screen [x,y] that falls in the tile.
+ */
+void LCD_TileDrawBitmap(LCD_Tile *tile, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap) {
+    int32_t col_first = tile->x > x ? tile->x : x;
+    int32_t row_first = tile->y > y ? tile->y : y;
+    int32_t col_end = (int32_t)x + w;
+    int32_t row_end = (int32_t)y + h;
+    const uint16_t *source;
+    uint16_t *row;
+    int32_t col, line;
+    
+    if (col_end > tile->x + tile->w) col_end = tile->x + tile->w;
+    if (row_end > tile->y + tile->h) row_end = tile->y + tile->h;
+    
+    for (line = row_first; line < row_end; line++) {
+        row = tile->pixels + (line - tile->y) * tile->w;
+        source = bitmap + (line - y) * w;
+        for (col = col_first; col < col_end; col++)
+            row[col - tile->x] = source[col - x];
+    }
+}
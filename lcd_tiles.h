@@ -0,0 +1,44 @@
+/*
+ * Tile renderer: the screen is split into fixed tiles and a bitmap records
+ * which of them changed. LCD_TilesRender() asks the application to draw
+ * each dirty tile into a small buffer and sends it with one windowed burst,
+ * so a frame costs only the tiles it touched.
+ */
+
+#ifndef __LCD_TILES_H
+#define __LCD_TILES_H
+
+#include "SSD1289.h"
+
+#ifndef LCD_TILE_WIDTH
+#define LCD_TILE_WIDTH           32
+#endif
+#ifndef LCD_TILE_HEIGHT
+#define LCD_TILE_HEIGHT          16
+#endif
+
+#define LCD_TILES_X              ((LCD_PIXEL_WIDTH + LCD_TILE_WIDTH - 1) / LCD_TILE_WIDTH)
+#define LCD_TILES_Y              ((LCD_PIXEL_HEIGHT + LCD_TILE_HEIGHT - 1) / LCD_TILE_HEIGHT)
+#define LCD_TILES                (LCD_TILES_X * LCD_TILES_Y)
+
+/* Tile being rendered, [x,y,w,h] is its screen rectangle */
+typedef struct {
+    uint16_t *pixels;   /* w*h pixels, row by row */
+    int16_t   x;
+    int16_t   y;
+    uint16_t  w;
+    uint16_t  h;
+} LCD_Tile;
+
+/* Draws everything that covers the tile into tile->pixels */
+typedef void (*LCD_TileRenderCallback)(LCD_Tile *tile);
+
+void LCD_TilesInit(LCD_TileRenderCallback render);
+void LCD_TilesInvalidate(int16_t x, int16_t y, uint16_t w, uint16_t h);
+void LCD_TilesInvalidateAll(void);
+uint16_t LCD_TilesRender(void);
+
+void LCD_TileFillRect(LCD_Tile *tile, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+void LCD_TileDrawBitmap(LCD_Tile *tile, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *bitmap);
+
+#endif /* __LCD_TILES_H */
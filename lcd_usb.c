@@ -0,0 +1,330 @@
+/*
+ * Display requests over the vendor bulk interface, see lcd_usb.h.
+ */
+
+#include "lcd_usb.h"
+#include "lcd_rle.h"
+#ifndef LCD_SIMULATOR
+#include "usbd_core.h"
+#include "usbd_desc.h"
+#include "usbd_usr.h"
+#include "usbd_lcd_core.h"
+
+extern USB_OTG_CORE_HANDLE USB_OTG_dev;
+#endif
+
+/* IN buffers: one is on the bus while the other one is filled */
+__ALIGN_BEGIN static uint8_t LCD_USBTx[2][LCD_USB_TX_SIZE] __ALIGN_END;
+static uint8_t  LCD_USBTxIndex = 0;
+static uint16_t LCD_USBTxFill = 0;
+static uint8_t  LCD_USBTxZLP = 0;       /* last transfer ended on a packet boundary */
+
+/* Screenshot in progress */
+static uint8_t  LCD_ShotActive = 0;
+static uint16_t LCD_ShotRow = 0;
+static uint16_t LCD_ShotLine[LCD_PIXEL_WIDTH];
+
+/* OUT stream parser */
+static uint8_t  *LCD_USBRxData = 0;     /* unread part of the held OUT buffer */
+static uint16_t LCD_USBRxLeft = 0;
+static uint8_t  LCD_USBRxHeld = 0;
+static uint8_t  LCD_USBHeader[LCD_USB_MAX_REQ_SIZE];
+static uint8_t  LCD_USBHeaderFill = 0;
+static uint32_t LCD_USBPayload = 0;     /* payload bytes still to come */
+static uint8_t  LCD_USBSink;            /* where they go, LCD_USB_SINK_* */
+static uint8_t  LCD_USBSession = 0;     /* USBD_LCD_Session() it belongs to */
+
+#define LCD_USB_SINK_PIXELS      0      /* GRAM window of a blit */
+#define LCD_USB_SINK_DISCARD     1
+#define LCD_USB_SINK_TEXT        2
+
+/* Text run being received */
+static char     LCD_USBText[LCD_USB_TEXT_MAX + 1];
+static uint8_t  LCD_USBTextFill;
+static uint16_t LCD_USBTextLength;
+static int16_t  LCD_USBTextX, LCD_USBTextY;
+static uint16_t LCD_USBTextColor, LCD_USBTextBack;
+static uint8_t  LCD_USBTextAA;
+
+static const LCD_USBAsset *LCD_USBAssets = 0;
+static uint16_t LCD_USBAssetCount = 0;
+
+void LCD_USBInit(void) {
+#ifndef LCD_SIMULATOR
+    USBD_Init(&USB_OTG_dev, USB_OTG_FS_CORE_ID, &USR_desc, &USBD_LCD_cb, &USR_cb);
+#endif
+}
+
+/*
+ * Images the host may draw with LCD_USB_REQ_ASSET, "id" is the index in
+ * "assets". The table must stay valid while USB is running.
+ */
+void LCD_USBSetAssets(const LCD_USBAsset *assets, uint16_t count) {
+    LCD_USBAssets = assets;
+    LCD_USBAssetCount = count;
+}
+
+/*
+ * Hand the filled buffer to the IN endpoint if it is free. Returns 0 while
+ * there is still something to send, including the closing zero length
+ * packet a reply needs when it ends exactly on a packet boundary.
+ */
+static uint8_t LCD_USBTxStep(uint8_t last) {
+    if (USBD_LCD_TxBusy())
+        return 0;
+    if (LCD_USBTxFill != 0) {
+        USBD_LCD_Send(LCD_USBTx[LCD_USBTxIndex], LCD_USBTxFill);
+        LCD_USBTxZLP = (LCD_USBTxFill % LCD_USB_PACKET) == 0;
+        LCD_USBTxIndex ^= 1;
+        LCD_USBTxFill = 0;
+        return 0;
+    }
+    if (!last)
+        return 0;
+    if (LCD_USBTxZLP) {
+        USBD_LCD_Send(LCD_USBTx[LCD_USBTxIndex], 0);
+        LCD_USBTxZLP = 0;
+        return 0;
+    }
+    return 1;
+}
+
+static void LCD_ShotStart(void) {
+    uint8_t *header = LCD_USBTx[LCD_USBTxIndex];
+    
+    header[0] = LCD_USB_SHOT_MAGIC0;
+    header[1] = LCD_USB_SHOT_MAGIC1;
+    header[2] = (uint8_t)LCD_PIXEL_WIDTH;
+    header[3] = (uint8_t)(LCD_PIXEL_WIDTH >> 8);
+    header[4] = (uint8_t)LCD_PIXEL_HEIGHT;
+    header[5] = (uint8_t)(LCD_PIXEL_HEIGHT >> 8);
+    header[6] = 0;
+    header[7] = 0;
+    LCD_USBTxFill = LCD_USB_SHOT_HEADER;
+    LCD_ShotRow = 0;
+    LCD_ShotActive = 1;
+}
+
+/*
+ * Encode rows into the free buffer while the other one is on the bus. A
+ * row is read with one window and one burst.
+ */
+static void LCD_ShotStep(void) {
+    uint8_t *buffer = LCD_USBTx[LCD_USBTxIndex];
+    
+    while (LCD_ShotRow < LCD_PIXEL_HEIGHT &&
+           LCD_USBTxFill + LCD_RLE_MAX_BYTES(LCD_PIXEL_WIDTH) <= LCD_USB_TX_SIZE) {
+        LCD_ReadWindow(0, LCD_ShotRow, LCD_PIXEL_WIDTH, 1, LCD_ShotLine);
+        LCD_USBTxFill += LCD_RLEEncode(LCD_ShotLine, LCD_PIXEL_WIDTH, buffer + LCD_USBTxFill);
+        LCD_ShotRow++;
+    }
+    if (LCD_USBTxStep(LCD_ShotRow == LCD_PIXEL_HEIGHT))
+        LCD_ShotActive = 0;
+}
+
+static uint8_t LCD_USBRequestSize(uint8_t code) {
+    switch (code) {
+    case LCD_USB_REQ_SCREENSHOT: return LCD_USB_SHOT_REQ_SIZE;
+    case LCD_USB_REQ_BLIT:       return LCD_USB_BLIT_REQ_SIZE;
+    case LCD_USB_REQ_FILL:       return LCD_USB_FILL_REQ_SIZE;
+    case LCD_USB_REQ_LINE:       return LCD_USB_LINE_REQ_SIZE;
+    case LCD_USB_REQ_TEXT:       return LCD_USB_TEXT_REQ_SIZE;
+    case LCD_USB_REQ_ASSET:      return LCD_USB_ASSET_REQ_SIZE;
+    case LCD_USB_REQ_SCROLL:     return LCD_USB_SCROLL_REQ_SIZE;
+    default:                     return 0;
+    }
+}
+
+static uint16_t LCD_USBGet16(const uint8_t *data) {
+    return data[0] | (data[1] << 8);
+}
+
+/* Header arguments, "index" counts 16 bit fields after code and flags */
+static uint16_t LCD_USBArg(uint8_t index) {
+    return LCD_USBGet16(LCD_USBHeader + 2 + index * 2);
+}
+
+/* DMA from the held buffer or an asset finished, the task can go on */
+static void LCD_USBDMADone(void) {
+    USBD_LCD_Notify();
+}
+
+/* Draw in the host's colours, the firmware's own text keeps its colours */
+static void LCD_USBTextDone(void) {
+    uint16_t text = TextColor;
+    uint16_t back = BackColor;
+    
+    LCD_USBText[LCD_USBTextFill] = 0;
+    LCD_SetTextColors(LCD_USBTextColor, LCD_USBTextBack);
+    if (LCD_USBTextAA)
+        LCD_DrawStringAA(LCD_USBTextX, LCD_USBTextY, LCD_USBText);
+    else
+        LCD_DrawString(LCD_USBTextX, LCD_USBTextY, LCD_USBText);
+    LCD_SetTextColors(text, back);
+}
+
+static void LCD_USBRequest(void) {
+    const LCD_USBAsset *asset;
+    uint16_t x, y, w, h;
+    
+    switch (LCD_USBHeader[0]) {
+    case LCD_USB_REQ_SCREENSHOT:
+        LCD_ShotStart();
+        break;
+    case LCD_USB_REQ_BLIT:
+        x = LCD_USBArg(0);
+        y = LCD_USBArg(1);
+        w = LCD_USBArg(2);
+        h = LCD_USBArg(3);
+        LCD_USBPayload = (uint32_t)w * h * 2;
+        if (w == 0 || h == 0 ||
+            (uint32_t)x + w > LCD_PIXEL_WIDTH || (uint32_t)y + h > LCD_PIXEL_HEIGHT) {
+            LCD_USBSink = LCD_USB_SINK_DISCARD;
+            break;
+        }
+        LCD_SetWindow(x, y, w, h);
+        LCD_USBSink = LCD_USB_SINK_PIXELS;
+        break;
+    case LCD_USB_REQ_FILL:
+        LCD_FillRect((int16_t)LCD_USBArg(0), (int16_t)LCD_USBArg(1),
+                     LCD_USBArg(2), LCD_USBArg(3), LCD_USBArg(4));
+        break;
+    case LCD_USB_REQ_LINE:
+        LCD_DrawLine((int16_t)LCD_USBArg(0), (int16_t)LCD_USBArg(1),
+                     (int16_t)LCD_USBArg(2), (int16_t)LCD_USBArg(3), LCD_USBArg(4));
+        break;
+    case LCD_USB_REQ_TEXT:
+        LCD_USBTextAA = LCD_USBHeader[1] & LCD_USB_TEXT_AA;
+        LCD_USBTextX = (int16_t)LCD_USBArg(0);
+        LCD_USBTextY = (int16_t)LCD_USBArg(1);
+        LCD_USBTextColor = LCD_USBArg(2);
+        LCD_USBTextBack = LCD_USBArg(3);
+        LCD_USBTextLength = LCD_USBArg(4);
+        LCD_USBTextFill = 0;
+        LCD_USBPayload = (LCD_USBTextLength + 1) & ~1UL;
+        LCD_USBSink = LCD_USB_SINK_TEXT;
+        if (LCD_USBPayload == 0)
+            LCD_USBTextDone();
+        break;
+    case LCD_USB_REQ_ASSET:
+        if (LCD_USBArg(0) >= LCD_USBAssetCount)
+            break;
+        asset = &LCD_USBAssets[LCD_USBArg(0)];
+        LCD_DrawBitmapAsync((int16_t)LCD_USBArg(1), (int16_t)LCD_USBArg(2),
+                            asset->w, asset->h, asset->pixels, asset->w, LCD_USBDMADone);
+        break;
+    case LCD_USB_REQ_SCROLL:
+        LCD_SetScrollRegion(LCD_USBArg(0), LCD_USBArg(1));
+        LCD_ScrollTo(LCD_USBArg(2));
+        break;
+    }
+}
+
+/* Keep the characters of a text run that fit, draw it once complete */
+static void LCD_USBTextData(const uint8_t *data, uint32_t count) {
+    while (count--) {
+        if (LCD_USBTextFill < LCD_USBTextLength && LCD_USBTextFill < LCD_USB_TEXT_MAX)
+            LCD_USBText[LCD_USBTextFill++] = (char)*data;
+        data++;
+    }
+    if (LCD_USBPayload == 0)
+        LCD_USBTextDone();
+}
+
+/*
+ * Consume the held OUT buffer: collect a request header, or pass on the
+ * payload it holds. Blit pixels go to GRAM with one DMA transfer.
+ */
+static void LCD_USBParse(void) {
+    uint32_t count;
+    uint8_t size;
+    
+    if (LCD_USBPayload) {
+        count = LCD_USBPayload < LCD_USBRxLeft ? LCD_USBPayload : LCD_USBRxLeft;
+        count &= ~1UL;
+        if (count == 0) {
+            /* Odd sized piece, the stream is out of step: drop it */
+            LCD_USBPayload = 0;
+            LCD_USBRxLeft = 0;
+            return;
+        }
+        LCD_USBPayload -= count;
+        if (LCD_USBSink == LCD_USB_SINK_PIXELS)
+            LCD_WriteDMA((const uint16_t *)LCD_USBRxData, count / 2, LCD_USBDMADone);
+        else if (LCD_USBSink == LCD_USB_SINK_TEXT)
+            LCD_USBTextData(LCD_USBRxData, count);
+        LCD_USBRxData += count;
+        LCD_USBRxLeft -= count;
+        return;
+    }
+    
+    size = LCD_USBHeaderFill ? LCD_USBRequestSize(LCD_USBHeader[0])
+                             : LCD_USBRequestSize(LCD_USBRxData[0]);
+    if (size == 0) {
+        /* Unknown request, skip to the next transfer */
+        LCD_USBRxLeft = 0;
+        return;
+    }
+    /* A header may be split over two buffers */
+    while (LCD_USBHeaderFill < size && LCD_USBRxLeft) {
+        LCD_USBHeader[LCD_USBHeaderFill++] = *LCD_USBRxData++;
+        LCD_USBRxLeft--;
+    }
+    if (LCD_USBHeaderFill == size) {
+        LCD_USBHeaderFill = 0;
+        LCD_USBRequest();
+    }
+}
+
+/*
+ * Forget the request in flight and its buffers. The class starts over with
+ * empty buffers on every configure, so a held one is not released.
+ */
+static void LCD_USBReset(void) {
+    LCD_USBTxIndex = 0;
+    LCD_USBTxFill = 0;
+    LCD_USBTxZLP = 0;
+    LCD_ShotActive = 0;
+    LCD_USBRxData = 0;
+    LCD_USBRxLeft = 0;
+    LCD_USBRxHeld = 0;
+    LCD_USBHeaderFill = 0;
+    LCD_USBPayload = 0;
+    LCD_USBTextFill = 0;
+}
+
+/*
+ * Call from the main loop. Serves the pending request a step at a time.
+ * Returns 0 when it waits for the host or for its DMA, both of which end
+ * with USBD_LCD_Notify(), and 1 if it can go on right away.
+ */
+uint8_t LCD_USBProcess(void) {
+    /* A host killed mid-blit must not turn the next session into pixels */
+    if (USBD_LCD_Session() != LCD_USBSession) {
+        LCD_USBSession = USBD_LCD_Session();
+        LCD_USBReset();
+    }
+    if (LCD_ShotActive) {
+        LCD_ShotStep();
+        /* With both IN buffers taken, the next step waits for DataIn */
+        if (LCD_ShotActive)
+            return !USBD_LCD_TxBusy();
+        /* Requests behind it may already be waiting in the OUT buffers */
+        return 1;
+    }
+    /* The DMA may still be reading the held buffer */
+    if (LCD_DMABusy())
+        return 0;
+    if (LCD_USBRxLeft == 0) {
+        if (LCD_USBRxHeld) {
+            USBD_LCD_Release();
+            LCD_USBRxHeld = 0;
+        }
+        LCD_USBRxLeft = USBD_LCD_Received(&LCD_USBRxData);
+        if (LCD_USBRxLeft == 0)
+            return 0;
+        LCD_USBRxHeld = 1;
+    }
+    LCD_USBParse();
+    return 1;
+}
@@ -0,0 +1,36 @@
+/*
+ * Display requests over the vendor bulk interface (usbd_lcd_core.c), see
+ * lcd_usb_proto.h for the wire format.
+ *
+ * Requests are served by LCD_USBProcess() from the main loop, one step per
+ * call, so USB traffic overlaps with GRAM reads and never blocks drawing
+ * for a whole frame. It returns nonzero while it has more to do; once it
+ * returns 0 only USBD_LCD_Notify() gives it work again: new OUT data, a
+ * finished IN transfer or the end of its GRAM DMA.
+ *
+ * Blit pixels go from the OUT buffer to GRAM by DMA while the endpoint
+ * fills the other buffer. The window of a blit stays set between its
+ * chunks, so nothing else may draw while one is streaming in.
+ */
+
+#ifndef __LCD_USB_H
+#define __LCD_USB_H
+
+#include "SSD1289.h"
+#include "lcd_usb_proto.h"
+
+/* Size of each of the two IN buffers, a multiple of the packet size */
+#define LCD_USB_TX_SIZE          2048
+
+/* Image the host can draw by id with LCD_USB_REQ_ASSET */
+typedef struct {
+    const uint16_t *pixels;     /* w*h RGB565, flash or SRAM (DMA source) */
+    uint16_t        w;
+    uint16_t        h;
+} LCD_USBAsset;
+
+void LCD_USBInit(void);
+void LCD_USBSetAssets(const LCD_USBAsset *assets, uint16_t count);
+uint8_t LCD_USBProcess(void);
+
+#endif /* __LCD_USB_H */
@@ -0,0 +1,82 @@
+/*
+ * Wire format of the display's vendor bulk interface, shared by the
+ * firmware (lcd_usb.c) and the host tools in host/. Plain C, all values
+ * little endian.
+ *
+ * The OUT endpoint carries a stream of requests, each a fixed size header
+ * starting with the request code and a flags byte (0 unless noted),
+ * possibly followed by a payload. Requests may be split over transfers or
+ * share one, as long as every header and payload has an even length so
+ * pixels stay aligned. The board takes a transfer in once a buffer is full
+ * or a short packet ends it, so a transfer whose length is a multiple of
+ * LCD_USB_MAX_PACKET must be followed by a zero length packet.
+ *
+ *   LCD_USB_REQ_SCREENSHOT  LCD_USB_SHOT_REQ_SIZE bytes, no arguments. The
+ *                           reply on the IN endpoint is an
+ *                           LCD_USB_SHOT_HEADER byte header ('L', 'S', width,
+ *                           height, two reserved bytes) followed by the GRAM
+ *                           as lcd_rle.h tokens, rows top to bottom.
+ *
+ *   LCD_USB_REQ_BLIT        LCD_USB_BLIT_REQ_SIZE bytes: code, 0, x, y, w, h
+ *                           (16 bit each), followed by w*h RGB565 pixels
+ *                           row by row. No reply. A rectangle that is not
+ *                           fully on screen is skipped, its pixels are read
+ *                           and dropped.
+ *
+ * Drawing commands, executed by the driver on the board. Coordinates are
+ * signed and clipped like the LCD_* calls they map to; none has a reply.
+ *
+ *   LCD_USB_REQ_FILL        code, 0, x, y, w, h, color: LCD_FillRect().
+ *
+ *   LCD_USB_REQ_LINE        code, 0, x0, y0, x1, y1, color: LCD_DrawLine().
+ *
+ *   LCD_USB_REQ_TEXT        code, flags, x, y, text color, back color,
+ *                           length, followed by "length" characters padded
+ *                           to an even count. LCD_USB_TEXT_AA in flags
+ *                           selects the anti-aliased font. Characters past
+ *                           LCD_USB_TEXT_MAX are dropped.
+ *
+ *   LCD_USB_REQ_ASSET       code, 0, id, x, y: draws an image the firmware
+ *                           registered with LCD_USBSetAssets(). Unknown ids
+ *                           are ignored.
+ *
+ *   LCD_USB_REQ_SCROLL      code, 0, x, w, lines: LCD_SetScrollRegion(x, w)
+ *                           then LCD_ScrollTo(lines).
+ */
+
+#ifndef __LCD_USB_PROTO_H
+#define __LCD_USB_PROTO_H
+
+#include <stdint.h>
+
+#define LCD_USB_REQ_SCREENSHOT   0x01
+#define LCD_USB_REQ_BLIT         0x02
+#define LCD_USB_REQ_FILL         0x03
+#define LCD_USB_REQ_LINE         0x04
+#define LCD_USB_REQ_TEXT         0x05
+#define LCD_USB_REQ_ASSET        0x06
+#define LCD_USB_REQ_SCROLL       0x07
+
+/* The board's own id, the firmware's descriptor and host/ both use it */
+#define LCD_USB_VID              0x0483
+#define LCD_USB_PID              0x57E0
+
+#define LCD_USB_MAX_PACKET       64      /* bulk, full speed */
+
+#define LCD_USB_SHOT_REQ_SIZE    2
+#define LCD_USB_BLIT_REQ_SIZE    10
+#define LCD_USB_FILL_REQ_SIZE    12
+#define LCD_USB_LINE_REQ_SIZE    12
+#define LCD_USB_TEXT_REQ_SIZE    12
+#define LCD_USB_ASSET_REQ_SIZE   8
+#define LCD_USB_SCROLL_REQ_SIZE  8
+#define LCD_USB_MAX_REQ_SIZE     12
+
+#define LCD_USB_TEXT_AA          0x01
+#define LCD_USB_TEXT_MAX         64
+
+#define LCD_USB_SHOT_MAGIC0      'L'
+#define LCD_USB_SHOT_MAGIC1      'S'
+#define LCD_USB_SHOT_HEADER      8
+
+#endif /* __LCD_USB_PROTO_H */
@@ -26,6 +26,13 @@
 #include "usbd_desc.h"
 #include "SSD1289.h"
 #include "SSD1289.c"
+#include "lcd_usb.h"
+#include "timer.h"
+#include "sched.h"
+#include "mems.h"
+#ifdef LCD_BENCHMARK
+#include "lcd_bench.h"
+#endif
 
 /** @addtogroup STM32F4-Discovery_Demo
   * @{
@@ -38,6 +45,15 @@
 #define ALLTEST_PASS               0x00000000
 #define ALLTEST_FAIL               0x55555555
 
+/* Scheduler events */
+#define USB_EVENT_DATA             0x01    /* from the USB interrupt */
+#define USB_EVENT_CONTINUE         0x02    /* the task has more to do */
+#define MEMS_EVENT_SAMPLES         0x01    /* from the MEMS DMA interrupt */
+#define MEMS_EVENT_CONTINUE        0x02    /* more samples than one batch */
+
+/* Wake the MEMS task every 8 samples (20 ms at 400 Hz) */
+#define MEMS_WAKE_SAMPLES          8
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 #ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
@@ -49,7 +65,6 @@ __ALIGN_BEGIN USB_OTG_CORE_HANDLE  USB_OTG_dev __ALIGN_END;
   
 uint16_t PrescalerValue = 0;
 
-__IO uint32_t TimingDelay;
 __IO uint8_t DemoEnterCondition = 0x00;
 __IO uint8_t UserButtonPressed = 0x00;
 LIS302DL_InitTypeDef  LIS302DL_InitStruct;
@@ -57,47 +72,112 @@ LIS302DL_FilterConfigTypeDef LIS302DL_FilterStruct;
 __IO int8_t X_Offset, Y_Offset, Z_Offset  = 0x00;
 uint8_t Buffer[6];
 
+/* Hamming windowed sinc, 25 Hz cut-off at 400 Hz, Q15 */
+static const int16_t MEMS_Taps[8] = {512, 1924, 5437, 8511, 8511, 5437, 1924, 512};
+/* Low-pass, then 50 Hz out for the demo, then smoothed a little more */
+static const MEMS_FilterConfig MEMS_Filter = {MEMS_Taps, 8, 8, 1};
+
 TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
 TIM_OCInitTypeDef  TIM_OCInitStructure;
 uint16_t CCR1_Val = 300;
 uint16_t CCR2_Val = 100;
 
-int main(void){
-    Delay(0x3FFFFF);
+static uint8_t USB_Task;
+static uint8_t MEMS_Task;
+
+/* Private function prototypes -----------------------------------------------*/
+static void USB_TaskHandler(uint32_t events);
+static void MEMS_TaskHandler(uint32_t events);
+static void MEMS_SampleReady(void);
 
+int main(void){
+    /* Time to first pixel, LCD_BootStages shows it in the debugger */
+    LCD_BootStart();
+    /* Before the first NVIC_Init(): 1 bit preemption, 3 bits subpriority */
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_1);
     Init_SysTick();
     Init_LCD();
-    Delay(0x3FFFFF);
-    LCD_Clear(RED);
-
-    while (1) {
-       /* Clear_Screen(RED);
-        Delay(1000);
-        Clear_Screen(BLUE);
-        Delay(1000);*/
-    }
+#ifdef LCD_BENCHMARK
+    LCD_BenchRun();
+    LCD_BenchShow();
+#else
+    LCD_ClearDMA(RED);
+    LCD_BootMark("first frame");
+#endif
+    /* Tasks first, the USB interrupt posts to them */
+    USB_Task = Sched_AddTask("usb", USB_TaskHandler, SCHED_PRIO_BACKGROUND);
+    MEMS_Task = Sched_AddTask("mems", MEMS_TaskHandler, SCHED_PRIO_INPUT);
+    MEMS_FilterInit(&MEMS_Filter);
+    MEMS_Init(MEMS_SampleReady);
+    LCD_USBInit();
+    LCD_BootMark("usb");
+
+    Sched_Run();
+}
 
+/**
+  * @brief  Called from the USB interrupt when the display interface has
+  *         data or finished sending, wakes the USB task.
+  * @param  None
+  * @retval None
+  */
+void USBD_LCD_Notify(void) {
+    Sched_Post(USB_Task, USB_EVENT_DATA);
 }
 
 /**
-  * @brief  Inserts a delay time.
-  * @param  nTime: specifies the delay time length, in 10 ms.
+  * @brief  Serves display requests one step at a time, and posts itself
+  *         again while there is more to do so other tasks get their turn.
+  * @param  events: USB_EVENT_* bits
   * @retval None
-*/
-void Delay(__IO uint32_t nTime) {
-    TimingDelay = nTime;
-    while(TimingDelay != 0);
+  */
+static void USB_TaskHandler(uint32_t events) {
+    if (LCD_USBProcess())
+        Sched_Post(USB_Task, USB_EVENT_CONTINUE);
 }
 
 /**
-  * @brief  Decrements the TimingDelay variable.
+  * @brief  Called from the MEMS DMA interrupt for each new sample, wakes
+  *         the MEMS task once a batch has built up.
   * @param  None
   * @retval None
+  */
+static void MEMS_SampleReady(void) {
+    if (MEMS_Pending() >= MEMS_WAKE_SAMPLES)
+        Sched_Post(MEMS_Task, MEMS_EVENT_SAMPLES);
+}
+
+/**
+  * @brief  Filters a batch of samples, posting itself again while the ring
+  *         holds more. The LED demo, if enabled, paces itself by the filter
+  *         outputs, so no timer wakes the core for it.
+  * @param  events: MEMS_EVENT_* bits
+  * @retval None
+  */
+static void MEMS_TaskHandler(uint32_t events) {
+    if (MEMS_FilterRun() == MEMS_FILTER_BATCH)
+        Sched_Post(MEMS_Task, MEMS_EVENT_CONTINUE);
+    if (DemoEnterCondition != 0x00)
+        MEMS_Process();
+}
+
+/**
+  * @brief  Inserts a delay time, sleeping between SysTick interrupts.
+  * @param  nTime: specifies the delay time length, in ms. It ends on the
+  *         nTime-th tick, so it may be up to 1 ms short.
+  * @retval None
 */
-void TimingDelay_Decrement(void) {
-    if (TimingDelay != 0x00) {
-        TimingDelay--;
+void Delay(__IO uint32_t nTime) {
+    uint32_t start = Timer_Now();
+    
+    /* Masked like Timer_Sleep(), a tick between the check and WFI ends it */
+    __disable_irq();
+    while (Timer_Now() - start < nTime) {
+        __WFI();
+        __enable_irq();
+        __disable_irq();
     }
+    __enable_irq();
 }
 
 /**
@@ -53,7 +53,6 @@
 #define ABS(x)         (x < 0) ? (-x) : x
 #define MAX(a,b)       (a < b) ? (b) : a
 /* Exported functions ------------------------------------------------------- */
-void TimingDelay_Decrement(void);
 void Delay(__IO uint32_t nTime);
 void Fail_Handler(void);
 #endif /* __STM32F4_DISCOVERY_DEMO_H */
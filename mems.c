@@ -0,0 +1,332 @@
+/*
+ * LIS302DL sampling by data-ready interrupt and SPI DMA, and the filter
+ * chain behind MEMS_GetView(), see mems.h.
+ */
+
+#include "mems.h"
+#include "stm32f4_discovery_lis302dl.h"
+
+/* Read from OUT_X with address increment: X, unused, Y, unused, Z */
+#define MEMS_SPI_READ            0x80
+#define MEMS_SPI_INCREMENT       0x40
+#define MEMS_FRAME               6
+
+/* CTRL_REG3: data ready on INT2, active high, push-pull */
+#define MEMS_CTRL3_DRDY_INT2     0x20
+
+__IO uint32_t MEMS_Samples = 0;
+__IO uint32_t MEMS_Overruns = 0;
+
+static MEMS_Sample MEMS_Ring[MEMS_RING_SIZE];
+static __IO uint8_t MEMS_Head = 0;      /* next slot to fill, DMA interrupt only */
+static __IO uint8_t MEMS_Tail = 0;      /* next slot to read, consumer only */
+
+static uint8_t MEMS_TxFrame[MEMS_FRAME] = {LIS302DL_OUT_X_ADDR | MEMS_SPI_READ | MEMS_SPI_INCREMENT};
+static uint8_t MEMS_RxFrame[MEMS_FRAME];
+static __IO uint8_t MEMS_Busy = 0;
+static uint32_t MEMS_Time;
+static MEMS_Callback MEMS_Done = 0;
+
+static void MEMS_DMAConfig(void) {
+    DMA_InitTypeDef DMA_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+    
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+    DMA_DeInit(MEMS_DMA_RX_STREAM);
+    DMA_DeInit(MEMS_DMA_TX_STREAM);
+    
+    DMA_InitStructure.DMA_Channel = MEMS_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&LIS302DL_SPI->DR;
+    DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)MEMS_RxFrame;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+    DMA_InitStructure.DMA_BufferSize = MEMS_FRAME;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+    DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+    DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+    DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+    DMA_Init(MEMS_DMA_RX_STREAM, &DMA_InitStructure);
+    
+    DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)MEMS_TxFrame;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+    DMA_Init(MEMS_DMA_TX_STREAM, &DMA_InitStructure);
+    
+    DMA_ITConfig(MEMS_DMA_RX_STREAM, DMA_IT_TC | DMA_IT_TE, ENABLE);
+    SPI_I2S_DMACmd(LIS302DL_SPI, SPI_I2S_DMAReq_Rx | SPI_I2S_DMAReq_Tx, ENABLE);
+    
+    NVIC_InitStructure.NVIC_IRQChannel = MEMS_DMA_RX_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+static void MEMS_DRDYConfig(void) {
+    GPIO_InitTypeDef GPIO_InitStructure;
+    EXTI_InitTypeDef EXTI_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+    
+    RCC_AHB1PeriphClockCmd(MEMS_DRDY_GPIO_CLK, ENABLE);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
+    
+    GPIO_InitStructure.GPIO_Pin = MEMS_DRDY_PIN;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+    GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
+    GPIO_Init(MEMS_DRDY_GPIO_PORT, &GPIO_InitStructure);
+    SYSCFG_EXTILineConfig(MEMS_DRDY_PORT_SOURCE, MEMS_DRDY_PIN_SOURCE);
+    
+    EXTI_InitStructure.EXTI_Line = MEMS_DRDY_EXTI_LINE;
+    EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+    EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising;
+    EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+    EXTI_Init(&EXTI_InitStructure);
+    
+    NVIC_InitStructure.NVIC_IRQChannel = MEMS_DRDY_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+/*
+ * Set the LIS302DL to 400 Hz with data ready on INT2 and start sampling.
+ * "callback" (may be 0) runs from the DMA interrupt after each sample.
+ * The polled LIS302DL_Read()/LIS302DL_Write() must not be used afterwards.
+ */
+void MEMS_Init(MEMS_Callback callback) {
+    LIS302DL_InitTypeDef LIS302DL_InitStructure;
+    uint8_t ctrl = MEMS_CTRL3_DRDY_INT2;
+    
+    MEMS_Done = callback;
+    
+    LIS302DL_InitStructure.Power_Mode = LIS302DL_LOWPOWERMODE_ACTIVE;
+    LIS302DL_InitStructure.Output_DataRate = LIS302DL_DATARATE_400;
+    LIS302DL_InitStructure.Axes_Enable = LIS302DL_XYZ_ENABLE;
+    LIS302DL_InitStructure.Full_Scale = LIS302DL_FULLSCALE_2_3;
+    LIS302DL_InitStructure.Self_Test = LIS302DL_SELFTEST_NORMAL;
+    LIS302DL_Init(&LIS302DL_InitStructure);
+    LIS302DL_Write(&ctrl, LIS302DL_CTRL_REG3_ADDR, 1);
+    
+    MEMS_DMAConfig();
+    MEMS_DRDYConfig();
+    
+    /* DRDY may already be high, its edge is gone: read once to restart it */
+    if (GPIO_ReadInputDataBit(MEMS_DRDY_GPIO_PORT, MEMS_DRDY_PIN) != Bit_RESET)
+        NVIC_SetPendingIRQ(MEMS_DRDY_IRQn);
+}
+
+static void MEMS_StartRead(void) {
+    MEMS_Busy = 1;
+    MEMS_Time = DWT->CYCCNT;
+    DMA_ClearFlag(MEMS_DMA_RX_STREAM, MEMS_DMA_RX_FLAGS);
+    DMA_ClearFlag(MEMS_DMA_TX_STREAM, MEMS_DMA_TX_FLAGS);
+    LIS302DL_CS_LOW();
+    DMA_SetCurrDataCounter(MEMS_DMA_RX_STREAM, MEMS_FRAME);
+    DMA_SetCurrDataCounter(MEMS_DMA_TX_STREAM, MEMS_FRAME);
+    /* RX first, so no byte arrives before its stream is ready */
+    DMA_Cmd(MEMS_DMA_RX_STREAM, ENABLE);
+    DMA_Cmd(MEMS_DMA_TX_STREAM, ENABLE);
+}
+
+/* EXTI1: a new sample is ready */
+void MEMS_DRDY_IRQHandler(void) {
+    EXTI_ClearITPendingBit(MEMS_DRDY_EXTI_LINE);
+    /* A read in flight picks up the new sample when it ends */
+    if (!MEMS_Busy)
+        MEMS_StartRead();
+}
+
+/* DMA2 stream 2: the SPI read is done, store the sample */
+void MEMS_DMA_IRQHandler(void) {
+    MEMS_Sample *sample;
+    uint8_t head = MEMS_Head;
+    uint8_t ok = DMA_GetITStatus(MEMS_DMA_RX_STREAM, MEMS_DMA_RX_IT_TC) != RESET;
+    
+    DMA_ClearITPendingBit(MEMS_DMA_RX_STREAM, MEMS_DMA_RX_IT_TC | MEMS_DMA_RX_IT_TE);
+    LIS302DL_CS_HIGH();
+    MEMS_Busy = 0;
+    
+    if (ok) {
+        if (((head + 1) & (MEMS_RING_SIZE - 1)) == MEMS_Tail) {
+            MEMS_Overruns++;
+        }else{
+            sample = &MEMS_Ring[head];
+            sample->time = MEMS_Time;
+            sample->x = (int8_t)MEMS_RxFrame[1];
+            sample->y = (int8_t)MEMS_RxFrame[3];
+            sample->z = (int8_t)MEMS_RxFrame[5];
+            /* The sample is complete before the consumer can see it */
+            __DMB();
+            MEMS_Head = (head + 1) & (MEMS_RING_SIZE - 1);
+            MEMS_Samples++;
+        }
+        if (MEMS_Done)
+            MEMS_Done();
+    }
+    
+    /* DRDY rose again during the read, its edge was not acted on */
+    if (GPIO_ReadInputDataBit(MEMS_DRDY_GPIO_PORT, MEMS_DRDY_PIN) != Bit_RESET)
+        MEMS_StartRead();
+}
+
+/*
+ * Take the oldest sample from the ring, thread context. Returns 0 if the
+ * ring is empty.
+ */
+uint8_t MEMS_ReadSample(MEMS_Sample *sample) {
+    uint8_t tail = MEMS_Tail;
+    
+    if (tail == MEMS_Head)
+        return 0;
+    __DMB();
+    *sample = MEMS_Ring[tail];
+    __DMB();
+    MEMS_Tail = (tail + 1) & (MEMS_RING_SIZE - 1);
+    return 1;
+}
+
+/* Samples waiting in the ring */
+uint8_t MEMS_Pending(void) {
+    return (MEMS_Head - MEMS_Tail) & (MEMS_RING_SIZE - 1);
+}
+
+/*
+ * Filter state. The delay lines hold MEMS_FIR_MAX - 1 samples of history
+ * followed by the current batch, one array per axis so the tap loop runs
+ * over contiguous halfwords.
+ */
+#define MEMS_HISTORY             (MEMS_FIR_MAX - 1)
+#define MEMS_FRAC                8      /* filter state is Q8 counts */
+
+static MEMS_FilterConfig MEMS_Config;
+static int16_t MEMS_Line[3][MEMS_HISTORY + MEMS_FILTER_BATCH];
+static int32_t MEMS_State[3];
+static int8_t MEMS_Offset[3];
+static uint8_t MEMS_Calibrated;
+static uint8_t MEMS_Phase;
+
+/* Published views, written alternately; MEMS_ViewSeq & 1 is the current */
+static MEMS_View MEMS_Views[2];
+static __IO uint32_t MEMS_ViewSeq = 0;
+
+/*
+ * Set up the filter chain and clear its state. The first sample after
+ * this is taken as the zero point for all three axes.
+ */
+void MEMS_FilterInit(const MEMS_FilterConfig *config) {
+    uint16_t i;
+    uint8_t a;
+    
+    MEMS_Config = *config;
+    if (MEMS_Config.taps > MEMS_FIR_MAX)
+        MEMS_Config.taps = MEMS_FIR_MAX;
+    if (MEMS_Config.decimate == 0)
+        MEMS_Config.decimate = 1;
+    for (a = 0; a < 3; a++) {
+        for (i = 0; i < MEMS_HISTORY + MEMS_FILTER_BATCH; i++)
+            MEMS_Line[a][i] = 0;
+        MEMS_State[a] = 0;
+    }
+    MEMS_Calibrated = 0;
+    MEMS_Phase = 0;
+}
+
+/* One FIR output in Q8 at line[pos], the taps run backwards in time */
+static int32_t MEMS_FIR(const int16_t *line, uint16_t pos) {
+    const int16_t *h = MEMS_Config.fir;
+    const int16_t *x = &line[pos];
+    int32_t acc = 0;
+    uint8_t k;
+    
+    if (MEMS_Config.taps == 0)
+        return (int32_t)*x << MEMS_FRAC;
+    for (k = 0; k < MEMS_Config.taps; k++)
+        acc += h[k] * *x--;
+    return acc >> (15 - MEMS_FRAC);
+}
+
+/*
+ * Filter up to MEMS_FILTER_BATCH samples from the ring and publish the
+ * newest output, thread context. Only the decimated outputs are computed.
+ * Returns the number of samples taken; MEMS_FILTER_BATCH means there may
+ * be more.
+ */
+uint8_t MEMS_FilterRun(void) {
+    uint32_t time[MEMS_FILTER_BATCH];
+    MEMS_Sample sample;
+    MEMS_View *view;
+    int32_t out[3];
+    uint32_t last = 0;
+    uint8_t outputs = 0;
+    uint8_t n, i, a;
+    
+    for (n = 0; n < MEMS_FILTER_BATCH && MEMS_ReadSample(&sample); n++) {
+        if (!MEMS_Calibrated) {
+            MEMS_Offset[0] = sample.x;
+            MEMS_Offset[1] = sample.y;
+            MEMS_Offset[2] = sample.z;
+            MEMS_Calibrated = 1;
+        }
+        time[n] = sample.time;
+        MEMS_Line[0][MEMS_HISTORY + n] = sample.x - MEMS_Offset[0];
+        MEMS_Line[1][MEMS_HISTORY + n] = sample.y - MEMS_Offset[1];
+        MEMS_Line[2][MEMS_HISTORY + n] = sample.z - MEMS_Offset[2];
+    }
+    if (n == 0)
+        return 0;
+    
+    for (i = 0; i < n; i++) {
+        if (++MEMS_Phase < MEMS_Config.decimate)
+            continue;
+        MEMS_Phase = 0;
+        for (a = 0; a < 3; a++) {
+            out[a] = MEMS_FIR(MEMS_Line[a], MEMS_HISTORY + i);
+            if (MEMS_Config.iir_shift)
+                MEMS_State[a] += (out[a] - MEMS_State[a]) >> MEMS_Config.iir_shift;
+            else
+                MEMS_State[a] = out[a];
+        }
+        last = time[i];
+        outputs++;
+    }
+    
+    /* Keep the newest samples as history for the next batch */
+    for (a = 0; a < 3; a++)
+        for (i = 0; i < MEMS_HISTORY; i++)
+            MEMS_Line[a][i] = MEMS_Line[a][n + i];
+    
+    if (outputs) {
+        /* Fill the idle view, then flip; readers never see it half done */
+        view = &MEMS_Views[(MEMS_ViewSeq + 1) & 1];
+        view->time = last;
+        view->count = MEMS_Views[MEMS_ViewSeq & 1].count + outputs;
+        view->x = (MEMS_State[0] + (1 << (MEMS_FRAC - 1))) >> MEMS_FRAC;
+        view->y = (MEMS_State[1] + (1 << (MEMS_FRAC - 1))) >> MEMS_FRAC;
+        view->z = (MEMS_State[2] + (1 << (MEMS_FRAC - 1))) >> MEMS_FRAC;
+        __DMB();
+        MEMS_ViewSeq++;
+    }
+    return n;
+}
+
+/*
+ * Copy the newest filtered view, any context. Retries if it was
+ * republished during the copy, which only a preempting writer can do.
+ */
+void MEMS_GetView(MEMS_View *view) {
+    uint32_t seq;
+    
+    do {
+        seq = MEMS_ViewSeq;
+        __DMB();
+        *view = MEMS_Views[seq & 1];
+        __DMB();
+    } while (seq != MEMS_ViewSeq);
+}
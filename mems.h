@@ -0,0 +1,90 @@
+/*
+ * LIS302DL sampling without blocking SPI: the data-ready line (INT2, PE1)
+ * raises EXTI1, the handler starts a 6 byte SPI1 read by DMA and the DMA
+ * interrupt stores the sample in a ring buffer and calls the completion
+ * callback. Runs at the sensor's 400 Hz output rate.
+ *
+ * The ring has one producer (the DMA interrupt) and one consumer (thread
+ * context, MEMS_ReadSample() or MEMS_FilterRun()), so neither side locks.
+ *
+ * MEMS_FilterRun() takes the ring in batches through a fixed-point FIR
+ * low-pass, decimation and a one-pole IIR, and publishes the result as a
+ * view that readers take with MEMS_GetView() at any rate, from any context.
+ */
+
+#ifndef __MEMS_H
+#define __MEMS_H
+
+#include "stm32f4xx.h"
+
+#define MEMS_RING_SIZE           32     /* samples, a power of two */
+#define MEMS_FILTER_BATCH        16     /* samples per MEMS_FilterRun() */
+#define MEMS_FIR_MAX             16     /* taps */
+
+/* Data-ready on LIS302DL INT2; INT1 (PE0) shares EXTI0 with the button */
+#define MEMS_DRDY_GPIO_CLK       RCC_AHB1Periph_GPIOE
+#define MEMS_DRDY_GPIO_PORT      GPIOE
+#define MEMS_DRDY_PIN            GPIO_Pin_1
+#define MEMS_DRDY_EXTI_LINE      EXTI_Line1
+#define MEMS_DRDY_PORT_SOURCE    EXTI_PortSourceGPIOE
+#define MEMS_DRDY_PIN_SOURCE     EXTI_PinSource1
+#define MEMS_DRDY_IRQn           EXTI1_IRQn
+
+/* SPI1 on DMA2 channel 3; stream 0 is taken by the LCD */
+#define MEMS_DMA_CHANNEL         DMA_Channel_3
+#define MEMS_DMA_RX_STREAM       DMA2_Stream2
+#define MEMS_DMA_TX_STREAM       DMA2_Stream3
+#define MEMS_DMA_RX_IRQn         DMA2_Stream2_IRQn
+#define MEMS_DMA_RX_IT_TC        DMA_IT_TCIF2
+#define MEMS_DMA_RX_IT_TE        DMA_IT_TEIF2
+#define MEMS_DMA_RX_FLAGS        (DMA_FLAG_TCIF2 | DMA_FLAG_HTIF2 | DMA_FLAG_TEIF2 | \
+                                  DMA_FLAG_DMEIF2 | DMA_FLAG_FEIF2)
+#define MEMS_DMA_TX_FLAGS        (DMA_FLAG_TCIF3 | DMA_FLAG_HTIF3 | DMA_FLAG_TEIF3 | \
+                                  DMA_FLAG_DMEIF3 | DMA_FLAG_FEIF3)
+
+/* One acceleration sample, raw LIS302DL counts (18 mg at +-2.3 g) */
+typedef struct {
+    uint32_t time;      /* DWT cycle count at data ready */
+    int8_t   x;
+    int8_t   y;
+    int8_t   z;
+} MEMS_Sample;
+
+/*
+ * Filter chain, applied per axis after removing the offsets:
+ * FIR (Q15 taps, summing to 32768 for unity gain; none if taps is 0),
+ * keep every decimate-th output, then y += (x - y) >> iir_shift
+ * (bypassed if 0).
+ */
+typedef struct {
+    const int16_t *fir;
+    uint8_t taps;
+    uint8_t decimate;
+    uint8_t iir_shift;
+} MEMS_FilterConfig;
+
+/* Filtered acceleration, offsets removed */
+typedef struct {
+    uint32_t time;      /* DWT cycle count at data ready of its last input */
+    uint32_t count;     /* outputs so far, unchanged means nothing new */
+    int16_t  x;         /* LIS302DL counts */
+    int16_t  y;
+    int16_t  z;
+} MEMS_View;
+
+/* Called from the DMA interrupt after each stored sample */
+typedef void (*MEMS_Callback)(void);
+
+extern __IO uint32_t MEMS_Samples;      /* stored */
+extern __IO uint32_t MEMS_Overruns;     /* dropped, the ring was full */
+
+void MEMS_Init(MEMS_Callback callback);
+uint8_t MEMS_ReadSample(MEMS_Sample *sample);
+uint8_t MEMS_Pending(void);
+void MEMS_FilterInit(const MEMS_FilterConfig *config);
+uint8_t MEMS_FilterRun(void);
+void MEMS_GetView(MEMS_View *view);
+void MEMS_DRDY_IRQHandler(void);
+void MEMS_DMA_IRQHandler(void);
+
+#endif /* __MEMS_H */
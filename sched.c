@@ -0,0 +1,120 @@
+/*
+ * Cooperative run-to-completion scheduler, see sched.h.
+ */
+
+#include "stm32f4xx.h"
+#include "sched.h"
+#include "timer.h"
+#include "SSD1289.h"
+
+Sched_Task Sched_Tasks[SCHED_MAX_TASKS];
+uint8_t Sched_TaskCount = 0;
+uint32_t Sched_IdleCycles = 0;          /* spent in WFI */
+
+/*
+ * One ready queue of task ids per priority. A task is queued only when
+ * its first event arrives, so a queue never holds more than all tasks.
+ */
+static uint8_t Sched_Queue[SCHED_PRIORITIES][SCHED_MAX_TASKS];
+static uint8_t Sched_Head[SCHED_PRIORITIES];
+static uint8_t Sched_Count[SCHED_PRIORITIES];
+
+/*
+ * Register a task, before interrupts start posting to it. Returns its id
+ * for Sched_Post(), or SCHED_MAX_TASKS if the table is full.
+ */
+uint8_t Sched_AddTask(const char *name, Sched_Handler handler, uint8_t priority) {
+    Sched_Task *task;
+    
+    if (Sched_TaskCount >= SCHED_MAX_TASKS || priority >= SCHED_PRIORITIES)
+        return SCHED_MAX_TASKS;
+    task = &Sched_Tasks[Sched_TaskCount];
+    task->name = name;
+    task->handler = handler;
+    task->priority = priority;
+    task->events = 0;
+    task->runs = 0;
+    task->cycles = 0;
+    task->max_cycles = 0;
+    return Sched_TaskCount++;
+}
+
+/* Add "events" (bits) to the task's pending events, from anywhere */
+void Sched_Post(uint8_t id, uint32_t events) {
+    Sched_Task *task;
+    uint32_t primask;
+    uint8_t priority;
+    
+    if (id >= Sched_TaskCount || events == 0)
+        return;
+    task = &Sched_Tasks[id];
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (task->events == 0) {
+        priority = task->priority;
+        Sched_Queue[priority][(Sched_Head[priority] + Sched_Count[priority]) % SCHED_MAX_TASKS] = id;
+        Sched_Count[priority]++;
+    }
+    task->events |= events;
+    __set_PRIMASK(primask);
+}
+
+/*
+ * Run the oldest ready task of the most urgent priority. Returns 0 if no
+ * task was ready.
+ */
+uint8_t Sched_RunOnce(void) {
+    Sched_Task *task = 0;
+    uint32_t events = 0, start, cycles;
+    uint8_t priority;
+    
+    __disable_irq();
+    for (priority = 0; priority < SCHED_PRIORITIES; priority++) {
+        if (Sched_Count[priority]) {
+            task = &Sched_Tasks[Sched_Queue[priority][Sched_Head[priority]]];
+            Sched_Head[priority] = (Sched_Head[priority] + 1) % SCHED_MAX_TASKS;
+            Sched_Count[priority]--;
+            events = task->events;
+            task->events = 0;
+            break;
+        }
+    }
+    __enable_irq();
+    if (!task)
+        return 0;
+    
+    start = LCD_CYCLES();
+    task->handler(events);
+    cycles = LCD_CYCLES() - start;
+    task->runs++;
+    task->cycles += cycles;
+    if (cycles > task->max_cycles)
+        task->max_cycles = cycles;
+    return 1;
+}
+
+/* Sleep until an interrupt unless a task or a timer is ready */
+static void Sched_Idle(void) {
+    uint32_t start;
+    uint8_t priority, ready = 0;
+    
+    __disable_irq();
+    for (priority = 0; priority < SCHED_PRIORITIES; priority++)
+        ready |= Sched_Count[priority] != 0;
+    if (!ready && !Timer_Due()) {
+        start = LCD_CYCLES();
+        __WFI();
+        Sched_IdleCycles += LCD_CYCLES() - start;
+    }
+    __enable_irq();
+}
+
+/* The main loop, never returns */
+void Sched_Run(void) {
+    /* Run-time accounting reads the DWT counter LCD_BootStart() started */
+    while (1) {
+        Timer_Poll();
+        if (!Sched_RunOnce())
+            Sched_Idle();
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * Cooperative run-to-completion scheduler.
+ *
+ * A task is a handler plus a priority. Sched_Post() sets event bits for a
+ * task and queues it on its priority's ready queue; it is safe from any
+ * interrupt, so ISRs only post and leave the work to the main loop. The
+ * loop runs the due software timers (timer.h), then the oldest ready task
+ * of the most urgent priority with all the events posted since its last
+ * run, and sleeps with WFI when nothing is ready.
+ *
+ * A handler must return quickly; long work is done in steps, the task
+ * posting itself again to continue after more urgent tasks had their turn.
+ */
+
+#ifndef __SCHED_H
+#define __SCHED_H
+
+#include <stdint.h>
+
+#define SCHED_MAX_TASKS          8
+#define SCHED_PRIORITIES         3      /* 0 is the most urgent */
+
+/* Priorities of the tasks in main.c */
+#define SCHED_PRIO_INPUT         0      /* sensors, buttons */
+#define SCHED_PRIO_RENDER        1
+#define SCHED_PRIO_BACKGROUND    2      /* USB transfers */
+
+typedef void (*Sched_Handler)(uint32_t events);
+
+/* Task and its run-time account, in HCLK cycles */
+typedef struct {
+    const char    *name;
+    Sched_Handler  handler;
+    uint8_t        priority;
+    volatile uint32_t events;   /* posted, not yet handled */
+    uint32_t       runs;
+    uint32_t       cycles;      /* total, wraps */
+    uint32_t       max_cycles;  /* longest run */
+} Sched_Task;
+
+extern Sched_Task Sched_Tasks[SCHED_MAX_TASKS];
+extern uint8_t Sched_TaskCount;
+extern uint32_t Sched_IdleCycles;
+
+uint8_t Sched_AddTask(const char *name, Sched_Handler handler, uint8_t priority);
+void Sched_Post(uint8_t task, uint32_t events);
+uint8_t Sched_RunOnce(void);
+void Sched_Run(void);
+
+#endif /* __SCHED_H */
@@ -20,12 +20,15 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "selftest.h"
+#include "timer.h"
 
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 #define MEMS_PASSCONDITION              15
+#define TEST_TIMEOUT                    500     /* ms */
 /* Private macro -------------------------------------------------------------*/
+#define TEST_RUNNING()                  (Timer_Now() - TestStart < TEST_TIMEOUT)
 /* Private variables ---------------------------------------------------------*/
 /* Init Structure definition */
 RCC_ClocksTypeDef      RCC_Clocks;
@@ -46,7 +49,7 @@ const int16_t sinebuf[48] = {0, 4276, 8480, 12539, 16383, 19947, 23169, 25995,
                              -28377, -30272, -31650, -32486, -32767, -32486, -31650, -30272,
                              -28377, -25995, -23169, -19947, -16383, -12539, -8480, -4276
                              };
-extern __IO uint32_t TimingDelay;
+static uint32_t TestStart;
 
 extern LIS302DL_InitTypeDef  LIS302DL_InitStruct;
 extern LIS302DL_FilterConfigTypeDef LIS302DL_FilterStruct;  
@@ -96,9 +99,9 @@ void Accelerometer_MEMS_Test(void)
     Fail_Handler();
   }
 
-  TimingDelay = 500;
+  TestStart = Timer_Now();
   /* Wait until detecting all MEMS direction or timeout */
-  while((memsteststatus == 0x00)&&(TimingDelay != 0x00))
+  while((memsteststatus == 0x00)&& TEST_RUNNING())
   {
     LIS302DL_Read(Buffer, LIS302DL_OUT_X_ADDR, 4);
     xdata = ABS((int8_t)(Buffer[0]));
@@ -500,9 +503,9 @@ void Audio_Test(void)
   ADC_Cmd(ADC1, ENABLE);
   ADC_Cmd(ADC2, ENABLE);
  
-  TimingDelay = 500;
+  TestStart = Timer_Now();
   /* Wait until detecting 500 data*/
-  while((audioteststatus == 0)&&(TimingDelay != 0))
+  while((audioteststatus == 0)&& TEST_RUNNING())
   {
     ADC_SoftwareStartConv(ADC1);
     while(ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC) == RESET);
@@ -555,9 +558,9 @@ void Audio_Test(void)
   ADC_Cmd(ADC1, ENABLE);
   ADC_Cmd(ADC2, ENABLE);
   
-  TimingDelay = 500;
+  TestStart = Timer_Now();
   /* Wait until detecting 50 data*/
-  while((audioteststatus == 0)&&(TimingDelay != 0))
+  while((audioteststatus == 0)&& TEST_RUNNING())
   {
     
     ADC_SoftwareStartConv(ADC1);
@@ -657,12 +660,12 @@ void Microphone_MEMS_Test(void)
   /* Waiting until MEMS microphone ready : Wake-up Time */
   Delay(10);
   
-  TimingDelay = 500;
+  TestStart = Timer_Now();
   /* Wait until detect the click on the MEMS microphone or TimeOut delay*/
-  while((index < 30) && (TimingDelay != 0x00))
+  while((index < 30) && TEST_RUNNING())
   { 
     /* Waiting RXNE Flag or TimeOut delay */
-    while((SPI_I2S_GetFlagStatus(SPI2, SPI_FLAG_RXNE) == RESET)&& (TimingDelay != 0x00))
+    while((SPI_I2S_GetFlagStatus(SPI2, SPI_FLAG_RXNE) == RESET)&& TEST_RUNNING())
     {}
     data = SPI_I2S_ReceiveData(SPI2);
     if (data == 0xFFFF)
@@ -0,0 +1,318 @@
+/*
+ * Software model of the SSD1289 as the driver uses it: index register,
+ * GRAM with cursor (R4Eh/R4Fh), window (R44h-R46h) and entry mode (R11h),
+ * the two vertical scroll screens (R41h/R42h, R48h-R4Bh, enabled from R07h),
+ * plus a synchronous stand-in for DMA2 Stream0.
+ *
+ * GRAM is 240 (X) * 320 (Y). The panel is mounted in landscape, so screen
+ * [x,y] shows GRAM [y,319-x] after the scroll remapping of GRAM Y.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "SSD1289.h"
+
+#define SIM_GRAM_X      240
+#define SIM_GRAM_Y      320
+
+static uint16_t SimGRAM[SIM_GRAM_Y][SIM_GRAM_X];
+static uint16_t SimReg[256];
+static uint8_t  SimIndex;
+static uint16_t SimX, SimY;         /* address counter */
+static uint8_t  SimDummyRead;       /* first GRAM read after R22h is a dummy */
+static LCD_SimBus SimBus;
+static uint64_t SimCycles;          /* HCLK cycles of bus traffic and delays */
+
+/*
+ * FSMC timing programmed by the driver, and the shortest write and read
+ * cycles (in HCLK cycles) the simulated panel latches correctly. Faster
+ * accesses corrupt the data, so LCD_FSMCCalibrate() has something to find.
+ */
+static LCD_FSMCTiming SimRead = {LCD_FSMC_READ_ADDSET, LCD_FSMC_READ_DATAST};
+static LCD_FSMCTiming SimWrite = {LCD_FSMC_ADDSET, LCD_FSMC_DATAST};
+static uint8_t  SimPanelWrite = 6;
+static uint8_t  SimPanelRead = 24;
+
+/* Mode A: ADDSET+1 + DATAST+1, reads two more for input synchronization */
+#define SIM_WRITE_CYCLES    (SimWrite.addset + 1 + SimWrite.datast + 1)
+#define SIM_READ_CYCLES     (SimRead.addset + 1 + SimRead.datast + 1 + 2)
+
+DMA_Stream_TypeDef LCD_SimDMA2Stream0;
+static uint32_t SimDMAFlags;        /* pending TCIF0/TEIF0 */
+static uint8_t  SimDMAIRQEnabled;
+static uint8_t  SimDMAInHandler;
+static uint8_t  SimDMAStartPending;
+
+void LCD_SimReset(void) {
+    memset(SimGRAM, 0, sizeof(SimGRAM));
+    memset(SimReg, 0, sizeof(SimReg));
+    SimReg[LCD_REG_68] = 0xEF00;
+    SimReg[LCD_REG_70] = 0x013F;
+    SimReg[LCD_REG_73] = 0x013F;
+    SimReg[0x11] = 0x6830;
+    SimIndex = 0;
+    SimX = SimY = 0;
+    SimDummyRead = 1;
+}
+
+void LCD_SimWriteIndex(uint16_t index) {
+    SimBus.commands++;
+    SimCycles += SIM_WRITE_CYCLES;
+    SimIndex = (uint8_t)index;
+    if (SimIndex == GDDRAM_PREPARE)
+        SimDummyRead = 1;
+}
+
+/* Move the address counter as set up by ID1:0 and AM in R11h */
+static void SimAdvance(void) {
+    uint16_t entry = SimReg[0x11];
+    uint8_t x_inc = (entry >> 4) & 1;
+    uint8_t y_inc = (entry >> 5) & 1;
+    uint16_t x_start = SimReg[LCD_REG_68] & 0xFF;
+    uint16_t x_end = SimReg[LCD_REG_68] >> 8;
+    uint16_t y_start = SimReg[LCD_REG_69];
+    uint16_t y_end = SimReg[LCD_REG_70];
+    uint8_t x_wrap = 0, y_wrap = 0;
+    
+    if (entry & 0x0008) {
+        /* Y first, X steps when Y leaves the window */
+        if (y_inc) { if (SimY >= y_end) { SimY = y_start; y_wrap = 1; } else SimY++; }
+        else       { if (SimY <= y_start) { SimY = y_end; y_wrap = 1; } else SimY--; }
+        if (y_wrap) {
+            if (x_inc) SimX = SimX >= x_end ? x_start : SimX + 1;
+            else       SimX = SimX <= x_start ? x_end : SimX - 1;
+        }
+    }else{
+        if (x_inc) { if (SimX >= x_end) { SimX = x_start; x_wrap = 1; } else SimX++; }
+        else       { if (SimX <= x_start) { SimX = x_end; x_wrap = 1; } else SimX--; }
+        if (x_wrap) {
+            if (y_inc) SimY = SimY >= y_end ? y_start : SimY + 1;
+            else       SimY = SimY <= y_start ? y_end : SimY - 1;
+        }
+    }
+}
+
+void LCD_SimWriteData(uint16_t data) {
+    SimBus.writes++;
+    SimCycles += SIM_WRITE_CYCLES;
+    if (SIM_WRITE_CYCLES < SimPanelWrite)
+        data ^= 0x0100;
+    if (SimIndex == GDDRAM_PREPARE) {
+        if (SimX < SIM_GRAM_X && SimY < SIM_GRAM_Y)
+            SimGRAM[SimY][SimX] = data;
+        SimAdvance();
+        return;
+    }
+    SimReg[SimIndex] = data;
+    if (SimIndex == LCD_REG_78)
+        SimX = data & 0xFF;
+    else if (SimIndex == LCD_REG_79)
+        SimY = data & 0x1FF;
+}
+
+uint16_t LCD_SimReadData(void) {
+    uint16_t data;
+    
+    SimBus.reads++;
+    SimCycles += SIM_READ_CYCLES;
+    if (SimIndex == LCD_REG_0)
+        return 0x8989;      /* device code */
+    if (SimIndex != GDDRAM_PREPARE)
+        return SimReg[SimIndex];
+    if (SimDummyRead) {
+        SimDummyRead = 0;
+        return 0;
+    }
+    data = (SimX < SIM_GRAM_X && SimY < SIM_GRAM_Y) ? SimGRAM[SimY][SimX] : 0;
+    SimAdvance();
+    if (SIM_READ_CYCLES < SimPanelRead)
+        data ^= 0x0001;
+    return data;
+}
+
+void LCD_SimBusReset(void) {
+    memset(&SimBus, 0, sizeof(SimBus));
+}
+
+void LCD_SimBusGet(LCD_SimBus *bus) {
+    *bus = SimBus;
+}
+
+/* Bus time at 168 MHz HCLK for the FSMC timing the driver programmed */
+uint32_t LCD_SimBusNanoseconds(const LCD_SimBus *bus) {
+    uint64_t cycles = (uint64_t)(bus->commands + bus->writes) * SIM_WRITE_CYCLES +
+                      (uint64_t)bus->reads * SIM_READ_CYCLES;
+    
+    return (uint32_t)(cycles * 1000 / 168);
+}
+
+/* Stand-in for the DWT cycle counter, only bus time and delays advance it */
+uint32_t LCD_SimCycles(void) {
+    return (uint32_t)SimCycles;
+}
+
+void LCD_SimSetPanelTiming(uint8_t write_cycles, uint8_t read_cycles) {
+    SimPanelWrite = write_cycles;
+    SimPanelRead = read_cycles;
+}
+
+void LCD_FSMCSetTiming(const LCD_FSMCTiming *read, const LCD_FSMCTiming *write) {
+    SimRead = *read;
+    SimWrite = *write;
+}
+
+/* GRAM line shown on gate line "y" with the scroll registers applied */
+static uint16_t SimScrolledY(uint16_t y) {
+    uint16_t display = SimReg[LCD_REG_7];
+    uint16_t start, end;
+    
+    if ((display & LCD_DISPLAY_SPT) && (display & LCD_DISPLAY_VLE2)) {
+        start = SimReg[LCD_REG_74];
+        end = SimReg[LCD_REG_75];
+        if (y >= start && y <= end && end >= start)
+            return start + (y - start + SimReg[LCD_REG_66]) % (end - start + 1);
+    }
+    if (display & LCD_DISPLAY_VLE1) {
+        start = SimReg[LCD_REG_72];
+        end = SimReg[LCD_REG_73];
+        if (y >= start && y <= end && end >= start)
+            return start + (y - start + SimReg[LCD_REG_65]) % (end - start + 1);
+    }
+    return y;
+}
+
+/* Pixel the panel shows at screen [x,y] */
+uint16_t LCD_SimGetPixel(uint16_t x, uint16_t y) {
+    if (x >= LCD_PIXEL_WIDTH || y >= LCD_PIXEL_HEIGHT)
+        return 0;
+    return SimGRAM[SimScrolledY(LCD_PIXEL_WIDTH - 1 - x)][y];
+}
+
+/* GRAM at screen [x,y] before scrolling, what a screenshot reads */
+uint16_t LCD_SimGetGRAM(uint16_t x, uint16_t y) {
+    if (x >= LCD_PIXEL_WIDTH || y >= LCD_PIXEL_HEIGHT)
+        return 0;
+    return SimGRAM[LCD_PIXEL_WIDTH - 1 - x][y];
+}
+
+/* Write the visible screen as a binary PPM. Returns 0 on success. */
+int LCD_SimDumpPPM(const char *path) {
+    FILE *file = fopen(path, "wb");
+    uint16_t x, y, color;
+    
+    if (!file)
+        return -1;
+    fprintf(file, "P6\n%d %d\n255\n", LCD_PIXEL_WIDTH, LCD_PIXEL_HEIGHT);
+    for (y = 0; y < LCD_PIXEL_HEIGHT; y++) {
+        for (x = 0; x < LCD_PIXEL_WIDTH; x++) {
+            color = LCD_SimGetPixel(x, y);
+            fputc(((color >> 11) & 0x1F) * 255 / 31, file);
+            fputc(((color >> 5) & 0x3F) * 255 / 63, file);
+            fputc((color & 0x1F) * 255 / 31, file);
+        }
+    }
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+/*
+ * DMA2 Stream0. Enabling the stream copies NDTR halfwords at once and then
+ * raises the interrupt. A handler that starts the next chunk does not
+ * recurse, the chunk runs when the handler returns.
+ */
+static void SimDMARun(void) {
+    DMA_Stream_TypeDef *stream = &LCD_SimDMA2Stream0;
+    const uint16_t *source;
+    uint32_t count;
+    
+    do {
+        SimDMAStartPending = 0;
+        source = (const uint16_t *)stream->PAR;
+        for (count = stream->NDTR; count != 0; count--) {
+            LCD_SimWriteData(*source);
+            if (stream->CR & DMA_PeripheralInc_Enable)
+                source++;
+        }
+        stream->NDTR = 0;
+        stream->CR &= ~DMA_SxCR_EN;
+        SimDMAFlags |= DMA_IT_TCIF0;
+        if (SimDMAIRQEnabled && (stream->CR & DMA_IT_TC)) {
+            SimDMAInHandler = 1;
+            LCD_DMA_IRQHandler();
+            SimDMAInHandler = 0;
+        }
+    } while (SimDMAStartPending);
+}
+
+void DMA_DeInit(DMA_Stream_TypeDef *DMAy_Streamx) {
+    memset((void *)DMAy_Streamx, 0, sizeof(*DMAy_Streamx));
+    SimDMAFlags = 0;
+}
+
+void DMA_Init(DMA_Stream_TypeDef *DMAy_Streamx, DMA_InitTypeDef *DMA_InitStruct) {
+    DMAy_Streamx->CR = DMA_InitStruct->DMA_DIR | DMA_InitStruct->DMA_PeripheralInc |
+                       DMA_InitStruct->DMA_MemoryInc;
+    DMAy_Streamx->NDTR = DMA_InitStruct->DMA_BufferSize;
+    DMAy_Streamx->PAR = DMA_InitStruct->DMA_PeripheralBaseAddr;
+    DMAy_Streamx->M0AR = DMA_InitStruct->DMA_Memory0BaseAddr;
+}
+
+void DMA_Cmd(DMA_Stream_TypeDef *DMAy_Streamx, FunctionalState NewState) {
+    if (NewState == DISABLE) {
+        DMAy_Streamx->CR &= ~DMA_SxCR_EN;
+        return;
+    }
+    DMAy_Streamx->CR |= DMA_SxCR_EN;
+    if (SimDMAInHandler)
+        SimDMAStartPending = 1;
+    else
+        SimDMARun();
+}
+
+void DMA_SetCurrDataCounter(DMA_Stream_TypeDef *DMAy_Streamx, uint16_t Counter) {
+    DMAy_Streamx->NDTR = Counter;
+}
+
+void DMA_ITConfig(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT, FunctionalState NewState) {
+    if (NewState != DISABLE)
+        DMAy_Streamx->CR |= DMA_IT;
+    else
+        DMAy_Streamx->CR &= ~DMA_IT;
+}
+
+ITStatus DMA_GetITStatus(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT) {
+    (void)DMAy_Streamx;
+    return (SimDMAFlags & DMA_IT) == DMA_IT ? SET : RESET;
+}
+
+void DMA_ClearITPendingBit(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT) {
+    (void)DMAy_Streamx;
+    SimDMAFlags &= ~(DMA_IT & 0x0FFFFFFF);
+}
+
+void NVIC_Init(NVIC_InitTypeDef *NVIC_InitStruct) {
+    if (NVIC_InitStruct->NVIC_IRQChannel == DMA2_Stream0_IRQn)
+        SimDMAIRQEnabled = NVIC_InitStruct->NVIC_IRQChannelCmd != DISABLE;
+}
+
+void RCC_AHB1PeriphClockCmd(uint32_t RCC_AHB1Periph, FunctionalState NewState) {
+    (void)RCC_AHB1Periph;
+    (void)NewState;
+}
+
+uint32_t LCD_SimRbit(uint32_t value) {
+    uint32_t result = 0;
+    uint8_t bit;
+    
+    for (bit = 0; bit < 32; bit++) {
+        result = (result << 1) | (value & 1);
+        value >>= 1;
+    }
+    return result;
+}
+
+/* No pins, bus or timers on the host, delays only count as time */
+void Delay(__IO uint32_t nTime) { SimCycles += (uint64_t)nTime * 168000; }
+void Init_SysTick(void) {}
+void LCD_CtrlLinesConfig(void) {}
+void TIM_Config(void) {}
+void LCD_BackLight(int procentai) { (void)procentai; }
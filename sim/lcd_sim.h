@@ -0,0 +1,134 @@
+/*
+ * Host (Linux) stand-in for the STM32F4 side of the SSD1289 driver.
+ *
+ * Compiling the driver with LCD_SIMULATOR defined routes LCD_WRITE_INDEX,
+ * LCD_WRITE_DATA and LCD_READ_DATA to a software model of the controller
+ * and provides just enough of the CMSIS/StdPeriph DMA interface for the
+ * DMA engine in SSD1289.c to run. DMA transfers complete synchronously and
+ * call LCD_DMA_IRQHandler() like the real interrupt.
+ */
+
+#ifndef __LCD_SIM_H
+#define __LCD_SIM_H
+
+#include <stdint.h>
+
+#define __IO    volatile
+#define __ALIGN_BEGIN
+#define __ALIGN_END     __attribute__((aligned(4)))
+
+#define __CLZ(x)        ((uint8_t)((x) ? __builtin_clz(x) : 32))
+#define __RBIT(x)       LCD_SimRbit(x)
+
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+
+/* DMA stream registers used by the driver */
+typedef struct {
+    __IO uint32_t  CR;
+    __IO uint32_t  NDTR;
+    __IO uintptr_t PAR;     /* wide enough for host pointers */
+    __IO uintptr_t M0AR;
+} DMA_Stream_TypeDef;
+
+typedef struct {
+    uint32_t  DMA_Channel;
+    uintptr_t DMA_PeripheralBaseAddr;
+    uintptr_t DMA_Memory0BaseAddr;
+    uint32_t  DMA_DIR;
+    uint32_t  DMA_BufferSize;
+    uint32_t  DMA_PeripheralInc;
+    uint32_t  DMA_MemoryInc;
+    uint32_t  DMA_PeripheralDataSize;
+    uint32_t  DMA_MemoryDataSize;
+    uint32_t  DMA_Mode;
+    uint32_t  DMA_Priority;
+    uint32_t  DMA_FIFOMode;
+    uint32_t  DMA_FIFOThreshold;
+    uint32_t  DMA_MemoryBurst;
+    uint32_t  DMA_PeripheralBurst;
+} DMA_InitTypeDef;
+
+typedef struct {
+    uint8_t NVIC_IRQChannel;
+    uint8_t NVIC_IRQChannelPreemptionPriority;
+    uint8_t NVIC_IRQChannelSubPriority;
+    FunctionalState NVIC_IRQChannelCmd;
+} NVIC_InitTypeDef;
+
+extern DMA_Stream_TypeDef LCD_SimDMA2Stream0;
+#define DMA2_Stream0                    (&LCD_SimDMA2Stream0)
+#define DMA2_Stream0_IRQn               56
+
+#define DMA_SxCR_EN                     ((uint32_t)0x00000001)
+#define DMA_Channel_0                   ((uint32_t)0x00000000)
+#define DMA_DIR_MemoryToMemory          ((uint32_t)0x00000080)
+#define DMA_PeripheralInc_Enable        ((uint32_t)0x00000200)
+#define DMA_PeripheralInc_Disable       ((uint32_t)0x00000000)
+#define DMA_MemoryInc_Enable            ((uint32_t)0x00000400)
+#define DMA_MemoryInc_Disable           ((uint32_t)0x00000000)
+#define DMA_PeripheralDataSize_HalfWord ((uint32_t)0x00000800)
+#define DMA_MemoryDataSize_HalfWord     ((uint32_t)0x00002000)
+#define DMA_Mode_Normal                 ((uint32_t)0x00000000)
+#define DMA_Priority_High               ((uint32_t)0x00020000)
+#define DMA_FIFOMode_Enable             ((uint32_t)0x00000004)
+#define DMA_FIFOThreshold_Full          ((uint32_t)0x00000003)
+#define DMA_MemoryBurst_Single          ((uint32_t)0x00000000)
+#define DMA_PeripheralBurst_Single      ((uint32_t)0x00000000)
+#define DMA_IT_TC                       ((uint32_t)0x00000010)
+#define DMA_IT_TE                       ((uint32_t)0x00000004)
+#define DMA_IT_TCIF0                    ((uint32_t)0x10008020)
+#define DMA_IT_TEIF0                    ((uint32_t)0x10004008)
+#define RCC_AHB1Periph_DMA2             ((uint32_t)0x00400000)
+
+void DMA_DeInit(DMA_Stream_TypeDef *DMAy_Streamx);
+void DMA_Init(DMA_Stream_TypeDef *DMAy_Streamx, DMA_InitTypeDef *DMA_InitStruct);
+void DMA_Cmd(DMA_Stream_TypeDef *DMAy_Streamx, FunctionalState NewState);
+void DMA_SetCurrDataCounter(DMA_Stream_TypeDef *DMAy_Streamx, uint16_t Counter);
+void DMA_ITConfig(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT, FunctionalState NewState);
+ITStatus DMA_GetITStatus(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT);
+void DMA_ClearITPendingBit(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT);
+void NVIC_Init(NVIC_InitTypeDef *NVIC_InitStruct);
+void RCC_AHB1PeriphClockCmd(uint32_t RCC_AHB1Periph, FunctionalState NewState);
+uint32_t LCD_SimRbit(uint32_t value);
+
+/* Board functions the driver calls */
+void Delay(__IO uint32_t nTime);
+void LCD_CtrlLinesConfig(void);
+void TIM_Config(void);
+
+/* Vendor USB class used by lcd_usb.c, the loopback in sim_loopback.c */
+#define LCD_USB_PACKET                  64
+
+uint8_t USBD_LCD_Session(void);
+void USBD_LCD_Notify(void);
+uint8_t USBD_LCD_Send(const uint8_t *data, uint16_t length);
+uint8_t USBD_LCD_TxBusy(void);
+uint16_t USBD_LCD_Received(uint8_t **data);
+void USBD_LCD_Release(void);
+
+/* FSMC transactions seen by the controller model */
+typedef struct {
+    uint32_t commands;      /* index register writes */
+    uint32_t writes;        /* data writes, register values and GRAM */
+    uint32_t reads;         /* data reads */
+} LCD_SimBus;
+
+/* Controller model */
+void LCD_SimWriteIndex(uint16_t index);
+void LCD_SimWriteData(uint16_t data);
+uint16_t LCD_SimReadData(void);
+void LCD_SimReset(void);
+uint16_t LCD_SimGetPixel(uint16_t x, uint16_t y);
+uint16_t LCD_SimGetGRAM(uint16_t x, uint16_t y);
+int LCD_SimDumpPPM(const char *path);
+void LCD_SimBusReset(void);
+void LCD_SimBusGet(LCD_SimBus *bus);
+uint32_t LCD_SimBusNanoseconds(const LCD_SimBus *bus);
+uint32_t LCD_SimCycles(void);
+int LCD_SimCheckBudgets(void);
+int LCD_SimLoopback(void);
+int LCD_SimRLE(void);
+void LCD_SimSetPanelTiming(uint8_t write_cycles, uint8_t read_cycles);
+
+#endif /* __LCD_SIM_H */
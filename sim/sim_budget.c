@@ -0,0 +1,143 @@
+/*
+ * Transaction budgets for the drawing primitives. Each workload runs on the
+ * simulated bus and fails if it issues more index writes, data writes or
+ * reads than recorded below. Lower a budget when a primitive gets cheaper,
+ * raise it only together with the change that needs it.
+ *
+ * The workloads draw on a SIM_BACK screen, and a few pixels of each are
+ * checked afterwards, so a primitive cannot meet its budget by drawing less.
+ */
+
+#include <stdio.h>
+#include "SSD1289.h"
+
+#define SIM_BACK        BLUE
+
+typedef struct {
+    int16_t  x, y;
+    uint16_t color;
+} SimPixel;
+
+typedef struct {
+    const char *name;
+    void (*draw)(void);
+    LCD_SimBus budget;
+    const SimPixel *pixels;     /* expected afterwards, ends with x < 0 */
+} SimBudget;
+
+static const uint16_t SimBitmap[64 * 48];
+static const Point SimStar[] = {
+    {160, 20}, {185, 95}, {260, 95}, {200, 140}, {225, 215},
+    {160, 170}, {95, 215}, {120, 140}, {60, 95}, {135, 95}
+};
+
+static void SimSetCursor(void)  { LCD_SetCursor(100, 200); }
+static void SimFillRect(void)   { LCD_FillRect(50, 50, 100, 100, RED); }
+static void SimClear(void)      { LCD_Clear(BLACK); }
+static void SimClearDMA(void)   { LCD_ClearDMA(BLACK); }
+static void SimBitmap64(void)   { LCD_DrawBitmap(10, 10, 64, 48, SimBitmap); }
+static void SimString(void)     { LCD_DrawString(0, 100, "20 characters of txt"); }
+static void SimStringAA(void)   { LCD_DrawStringAA(0, 100, "20 characters of txt"); }
+static void SimLineH(void)      { LCD_DrawLine(0, 120, 319, 120, WHITE); }
+static void SimLineDiag(void)   { LCD_DrawLine(0, 0, 319, 239, WHITE); }
+static void SimCircle(void)     { LCD_DrawCircle(160, 120, 50, WHITE); }
+static void SimFillCircle(void) { LCD_FillCircle(160, 120, 50, WHITE); }
+static void SimPolygon(void)    { LCD_FillPolygon(SimStar, sizeof(SimStar) / sizeof(SimStar[0]), YELLOW); }
+
+/* Corners inside and the pixels just outside them */
+static const SimPixel SimFillRectPixels[] = {
+    {50, 50, RED}, {149, 50, RED}, {50, 149, RED}, {149, 149, RED},
+    {49, 50, SIM_BACK}, {50, 49, SIM_BACK}, {150, 149, SIM_BACK}, {149, 150, SIM_BACK},
+    {-1}
+};
+static const SimPixel SimClearPixels[] = {
+    {0, 0, BLACK}, {319, 0, BLACK}, {0, 239, BLACK}, {319, 239, BLACK}, {160, 120, BLACK},
+    {-1}
+};
+static const SimPixel SimBitmapPixels[] = {
+    {10, 10, 0}, {73, 57, 0}, {9, 10, SIM_BACK}, {74, 57, SIM_BACK}, {73, 58, SIM_BACK},
+    {-1}
+};
+static const SimPixel SimLineHPixels[] = {
+    {0, 120, WHITE}, {319, 120, WHITE}, {0, 119, SIM_BACK}, {319, 121, SIM_BACK},
+    {-1}
+};
+static const SimPixel SimLineDiagPixels[] = {
+    {0, 0, WHITE}, {319, 239, WHITE}, {319, 0, SIM_BACK}, {0, 239, SIM_BACK},
+    {-1}
+};
+/* The four extremes, the pixels past them and the centre */
+static const SimPixel SimCirclePixels[] = {
+    {110, 120, WHITE}, {210, 120, WHITE}, {160, 70, WHITE}, {160, 170, WHITE},
+    {109, 120, SIM_BACK}, {211, 120, SIM_BACK}, {160, 69, SIM_BACK}, {160, 171, SIM_BACK},
+    {160, 120, SIM_BACK},
+    {-1}
+};
+static const SimPixel SimFillCirclePixels[] = {
+    {110, 120, WHITE}, {210, 120, WHITE}, {160, 70, WHITE}, {160, 170, WHITE},
+    {109, 120, SIM_BACK}, {211, 120, SIM_BACK}, {160, 69, SIM_BACK}, {160, 171, SIM_BACK},
+    {160, 120, WHITE},
+    {-1}
+};
+/* Centre and inside the top arm, outside the tip and between the arms */
+static const SimPixel SimPolygonPixels[] = {
+    {160, 120, YELLOW}, {160, 40, YELLOW}, {100, 100, YELLOW},
+    {160, 10, SIM_BACK}, {100, 50, SIM_BACK}, {160, 200, SIM_BACK},
+    {-1}
+};
+
+static const SimBudget SimBudgets[] = {
+    {"SetCursor",        SimSetCursor,  {2, 2, 0}},
+    {"FillRect 100x100", SimFillRect,   {6, 10005, 0},    SimFillRectPixels},
+    {"Clear",            SimClear,      {6, 76805, 0},    SimClearPixels},
+    {"ClearDMA",         SimClearDMA,   {6, 76805, 0},    SimClearPixels},
+    {"Bitmap 64x48",     SimBitmap64,   {6, 3077, 0},     SimBitmapPixels},
+    {"String 20 chars",  SimString,     {6, 3845, 0}},
+    {"StringAA 20 chars", SimStringAA,  {6, 3845, 0}},
+    {"Line horizontal",  SimLineH,      {6, 325, 0},      SimLineHPixels},
+    {"Line diagonal",    SimLineDiag,   {1440, 1520, 0},  SimLineDiagPixels},
+    {"Circle r50",       SimCircle,     {696, 864, 0},    SimCirclePixels},
+    {"FillCircle r50",   SimFillCircle, {606, 8510, 0},   SimFillCirclePixels},
+    {"Polygon star",     SimPolygon,    {1428, 14270, 0}, SimPolygonPixels},
+};
+
+/* Number of "pixels" that do not have their expected color */
+static int SimCheckPixels(const SimPixel *pixels) {
+    int wrong = 0;
+    
+    for (; pixels && pixels->x >= 0; pixels++)
+        wrong += LCD_SimGetPixel(pixels->x, pixels->y) != pixels->color;
+    return wrong;
+}
+
+/*
+ * Run every workload and print its transactions and estimated bus time.
+ * Returns the number of workloads over budget or with wrong pixels.
+ */
+int LCD_SimCheckBudgets(void) {
+    const SimBudget *entry;
+    LCD_SimBus bus;
+    int failed = 0;
+    uint8_t over;
+    int wrong;
+    
+    printf("%-18s %8s %8s %8s %10s\n", "primitive", "commands", "writes", "reads", "bus us");
+    for (entry = SimBudgets; entry < SimBudgets + sizeof(SimBudgets) / sizeof(SimBudgets[0]); entry++) {
+        LCD_Clear(SIM_BACK);
+        LCD_SimBusReset();
+        entry->draw();
+        LCD_WaitDMA();
+        LCD_SimBusGet(&bus);
+        over = bus.commands > entry->budget.commands || bus.writes > entry->budget.writes ||
+               bus.reads > entry->budget.reads;
+        wrong = SimCheckPixels(entry->pixels);
+        failed += over || wrong;
+        printf("%-18s %8lu %8lu %8lu %10.1f%s", entry->name, (unsigned long)bus.commands,
+               (unsigned long)bus.writes, (unsigned long)bus.reads,
+               LCD_SimBusNanoseconds(&bus) / 1000.0, over ? "  OVER BUDGET" : "");
+        if (wrong)
+            printf("  %d WRONG PIXELS", wrong);
+        printf("\n");
+    }
+    return failed;
+}
@@ -0,0 +1,282 @@
+/*
+ * USB loopback: drawing commands built by the host client (host/
+ * lcd_client.c) are fed through the firmware's request parser (lcd_usb.c)
+ * in place of the USB class, then the screen is compared with the same
+ * scene drawn by direct LCD_* calls. Transfers reach the parser through a
+ * model of the OUT endpoint, so one that the board would hold back is
+ * reported. A screenshot of the remote scene is decoded and compared too.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "SSD1289.h"
+#include "lcd_usb.h"
+#include "lcd_client.h"
+#include "lcd_rle.h"
+
+#define SIM_RX_SIZE     2048    /* like LCD_USB_RX_SIZE on the board */
+
+enum {SIM_FILL, SIM_LINE, SIM_TEXT, SIM_TEXT_AA, SIM_ASSET, SIM_BLIT, SIM_SCROLL};
+
+typedef struct {
+    uint8_t     op;
+    int16_t     a[5];
+    const char *text;
+    uint8_t     update;     /* part of a periodic dashboard update */
+} SimOp;
+
+static uint16_t SimIcon[24 * 24];
+static const LCD_USBAsset SimAssets[] = {{SimIcon, 24, 24}};
+
+static const SimOp SimScene[] = {
+    {SIM_FILL,    {0, 0, 320, 240, BLACK}},
+    {SIM_TEXT_AA, {10, 8, WHITE, BLACK}, "Dashboard"},
+    {SIM_ASSET,   {0, 280, 6}},
+    {SIM_FILL,    {9, 39, 302, 122, GREY}},
+    {SIM_FILL,    {10, 40, 300, 120, BLACK}},
+    {SIM_BLIT,    {250, 180, 40, 30}},
+    {SIM_BLIT,    {282, 4, 27, 1, 1}},
+    {SIM_ASSET,   {0, -8, 220}},
+    {SIM_LINE,    {10, 150, 60, 80, GREEN}, 0, 1},
+    {SIM_LINE,    {60, 80, 110, 120, GREEN}, 0, 1},
+    {SIM_LINE,    {110, 120, 160, 50, GREEN}, 0, 1},
+    {SIM_FILL,    {10, 180, 130, 16, GREEN}, 0, 1},
+    {SIM_FILL,    {140, 180, 70, 16, GREY}, 0, 1},
+    {SIM_TEXT,    {10, 200, YELLOW, BLACK}, "load  65 %  temp 41 C", 1},
+    {SIM_TEXT_AA, {10, 214, WHITE, BLUE}, "12:04:31", 1},
+    {SIM_SCROLL,  {0, 320, 40}},
+};
+
+#define SIM_OPS     (sizeof(SimScene) / sizeof(SimScene[0]))
+
+/* Blit source, [x,y] of the scene's blit */
+static uint16_t SimBlitPixel(uint16_t x, uint16_t y) {
+    return ASSEMBLE_RGB(x * 6, y * 8, 128);
+}
+
+/* OUT buffer: being received, then handed to the parser */
+static uint8_t  SimRx[SIM_RX_SIZE];
+static uint16_t SimRxFill;
+static uint16_t SimRxLength;
+static int      SimHeld;    /* transfers left in a buffer that never completed */
+
+uint8_t USBD_LCD_Session(void) { return 0; }
+void USBD_LCD_Notify(void) { }
+/* IN endpoint: replies collect here, SimTxShort tells if the last one ended */
+static uint8_t  SimTx[LCD_USB_SHOT_HEADER + LCD_PIXEL_HEIGHT * LCD_RLE_MAX_BYTES(LCD_PIXEL_WIDTH)];
+static uint32_t SimTxLength;
+static uint8_t  SimTxShort;
+
+uint8_t USBD_LCD_Send(const uint8_t *data, uint16_t length) {
+    if (SimTxLength + length <= sizeof(SimTx)) {
+        memcpy(SimTx + SimTxLength, data, length);
+        SimTxLength += length;
+    }
+    SimTxShort = length % LCD_USB_PACKET != 0 || length == 0;
+    return 0;
+}
+
+uint8_t USBD_LCD_TxBusy(void) { return 0; }
+
+uint16_t USBD_LCD_Received(uint8_t **data) {
+    *data = SimRx;
+    return SimRxLength;
+}
+
+void USBD_LCD_Release(void) {
+    SimRxLength = 0;
+}
+
+/*
+ * One packet into the OUT buffer. Like the endpoint on the board, the
+ * buffer goes to the parser once it is full or a short packet ends it; a
+ * zero length packet into an empty buffer carries nothing.
+ */
+static void SimPacket(const uint8_t *data, uint16_t length) {
+    memcpy(SimRx + SimRxFill, data, length);
+    SimRxFill += length;
+    if (length == LCD_USB_PACKET && SimRxFill < SIM_RX_SIZE)
+        return;
+    SimRxLength = SimRxFill;
+    while (SimRxLength)
+        LCD_USBProcess();
+    SimRxFill = 0;
+}
+
+/* LCD_ClientSink: one bulk transfer, sent like LCD_HostWrite() does */
+static int SimSink(void *context, const uint8_t *data, int length) {
+    int sent;
+    uint16_t count;
+    
+    for (sent = 0; sent < length; sent += count) {
+        count = length - sent > LCD_USB_PACKET ? LCD_USB_PACKET : length - sent;
+        SimPacket(data + sent, count);
+    }
+    if (length > 0 && length % LCD_USB_MAX_PACKET == 0)
+        SimPacket(data, 0);
+    SimHeld += SimRxFill != 0;
+    return 0;
+}
+
+/*
+ * The raw blit request, split over three transfers to cross buffers or,
+ * with a[4] set, as one
+ */
+static void SimSendBlit(LCD_Client *client, const int16_t *a) {
+    static uint8_t request[LCD_USB_BLIT_REQ_SIZE + 2 * 40 * 30];
+    uint8_t header[LCD_USB_BLIT_REQ_SIZE] = {LCD_USB_REQ_BLIT, 0,
+        (uint8_t)a[0], (uint8_t)(a[0] >> 8), (uint8_t)a[1], (uint8_t)(a[1] >> 8),
+        (uint8_t)a[2], 0, (uint8_t)a[3], 0};
+    uint8_t *pixels = request + LCD_USB_BLIT_REQ_SIZE;
+    uint16_t x, y, color;
+    
+    memcpy(request, header, sizeof(header));
+    for (y = 0; y < a[3]; y++)
+        for (x = 0; x < a[2]; x++) {
+            color = SimBlitPixel(x, y);
+            pixels[(y * a[2] + x) * 2] = (uint8_t)color;
+            pixels[(y * a[2] + x) * 2 + 1] = (uint8_t)(color >> 8);
+        }
+    LCD_ClientFlush(client);
+    if (a[4]) {
+        SimSink(0, request, sizeof(header) + a[2] * a[3] * 2);
+        return;
+    }
+    SimSink(0, request, 6);
+    SimSink(0, request + 6, sizeof(header) - 6);
+    SimSink(0, pixels, a[2] * a[3] * 2);
+}
+
+static void SimRemote(LCD_Client *client, uint8_t updates_only) {
+    const SimOp *op;
+    
+    for (op = SimScene; op < SimScene + SIM_OPS; op++) {
+        if (updates_only && !op->update)
+            continue;
+        switch (op->op) {
+        case SIM_FILL:    LCD_ClientFillRect(client, op->a[0], op->a[1], op->a[2], op->a[3], op->a[4]); break;
+        case SIM_LINE:    LCD_ClientLine(client, op->a[0], op->a[1], op->a[2], op->a[3], op->a[4]); break;
+        case SIM_TEXT:    LCD_ClientText(client, op->a[0], op->a[1], op->a[2], op->a[3], 0, op->text); break;
+        case SIM_TEXT_AA: LCD_ClientText(client, op->a[0], op->a[1], op->a[2], op->a[3], 1, op->text); break;
+        case SIM_ASSET:   LCD_ClientAsset(client, op->a[0], op->a[1], op->a[2]); break;
+        case SIM_BLIT:    SimSendBlit(client, op->a); break;
+        case SIM_SCROLL:  LCD_ClientScroll(client, op->a[0], op->a[1], op->a[2]); break;
+        }
+    }
+    LCD_ClientFlush(client);
+}
+
+static void SimDirect(void) {
+    static uint16_t blit[40 * 30];
+    const SimOp *op;
+    uint16_t x, y;
+    
+    for (op = SimScene; op < SimScene + SIM_OPS; op++) {
+        switch (op->op) {
+        case SIM_FILL: LCD_FillRect(op->a[0], op->a[1], op->a[2], op->a[3], op->a[4]); break;
+        case SIM_LINE: LCD_DrawLine(op->a[0], op->a[1], op->a[2], op->a[3], op->a[4]); break;
+        case SIM_TEXT:
+            LCD_SetTextColors(op->a[2], op->a[3]);
+            LCD_DrawString(op->a[0], op->a[1], op->text);
+            break;
+        case SIM_TEXT_AA:
+            LCD_SetTextColors(op->a[2], op->a[3]);
+            LCD_DrawStringAA(op->a[0], op->a[1], op->text);
+            break;
+        case SIM_ASSET:
+            LCD_DrawBitmap(op->a[1], op->a[2], SimAssets[op->a[0]].w, SimAssets[op->a[0]].h,
+                           SimAssets[op->a[0]].pixels);
+            break;
+        case SIM_BLIT:
+            for (y = 0; y < op->a[3]; y++)
+                for (x = 0; x < op->a[2]; x++)
+                    blit[y * op->a[2] + x] = SimBlitPixel(x, y);
+            LCD_DrawBitmap(op->a[0], op->a[1], op->a[2], op->a[3], blit);
+            break;
+        case SIM_SCROLL:
+            LCD_SetScrollRegion(op->a[0], op->a[1]);
+            LCD_ScrollTo(op->a[2]);
+            break;
+        }
+    }
+    LCD_WaitDMA();
+}
+
+/*
+ * Ask for a screenshot and decode the reply a packet at a time, like
+ * host/lcd_screenshot.c. Returns the number of pixels that differ from
+ * the simulated GRAM, or -1 if the reply is malformed or does not end.
+ */
+static int SimScreenshot(void) {
+    static uint16_t pixels[LCD_PIXEL_HEIGHT * LCD_PIXEL_WIDTH];
+    const uint8_t request[LCD_USB_SHOT_REQ_SIZE] = {LCD_USB_REQ_SCREENSHOT, 0};
+    uint32_t used = LCD_USB_SHOT_HEADER, have, count = 0, decoded, index;
+    int bad = 0;
+    
+    SimTxLength = 0;
+    SimTxShort = 0;
+    SimSink(0, request, sizeof(request));
+    if (!SimTxShort || SimTxLength < LCD_USB_SHOT_HEADER ||
+        SimTx[0] != LCD_USB_SHOT_MAGIC0 || SimTx[1] != LCD_USB_SHOT_MAGIC1 ||
+        (SimTx[2] | (SimTx[3] << 8)) != LCD_PIXEL_WIDTH ||
+        (SimTx[4] | (SimTx[5] << 8)) != LCD_PIXEL_HEIGHT)
+        return -1;
+    for (have = LCD_USB_PACKET; used < SimTxLength; have += LCD_USB_PACKET) {
+        if (have > SimTxLength)
+            have = SimTxLength;
+        used += LCD_RLEDecode(SimTx + used, have - used, pixels + count,
+                              LCD_PIXEL_HEIGHT * LCD_PIXEL_WIDTH - count, &decoded);
+        count += decoded;
+        if (have == SimTxLength && decoded == 0)
+            break;
+    }
+    if (used != SimTxLength || count != LCD_PIXEL_HEIGHT * LCD_PIXEL_WIDTH)
+        return -1;
+    for (index = 0; index < count; index++)
+        bad += pixels[index] != LCD_SimGetGRAM(index % LCD_PIXEL_WIDTH, index / LCD_PIXEL_WIDTH);
+    return bad;
+}
+
+/*
+ * Draw the scene both ways and compare the screens. Returns the number of
+ * pixels that differ.
+ */
+int LCD_SimLoopback(void) {
+    static uint16_t remote[LCD_PIXEL_HEIGHT][LCD_PIXEL_WIDTH];
+    static LCD_Client client;
+    uint32_t scene_bytes, blit_bytes;
+    uint16_t x, y;
+    int bad = 0, shot;
+    
+    for (y = 0; y < 24; y++)
+        for (x = 0; x < 24; x++)
+            SimIcon[y * 24 + x] = (x - 12) * (x - 12) + (y - 12) * (y - 12) < 100 ? RED : BLUE;
+    LCD_USBSetAssets(SimAssets, sizeof(SimAssets) / sizeof(SimAssets[0]));
+    
+    LCD_ClientInit(&client, SimSink, 0);
+    SimRemote(&client, 0);
+    for (y = 0; y < LCD_PIXEL_HEIGHT; y++)
+        for (x = 0; x < LCD_PIXEL_WIDTH; x++)
+            remote[y][x] = LCD_SimGetPixel(x, y);
+    scene_bytes = client.sent;
+    blit_bytes = 2 * LCD_USB_BLIT_REQ_SIZE + (40 * 30 + 27) * 2;
+    shot = SimScreenshot();
+    printf("screenshot: %lu bytes, %d pixels differ\n", (unsigned long)SimTxLength, shot);
+    
+    LCD_SimReset();
+    Init_LCD();
+    SimDirect();
+    for (y = 0; y < LCD_PIXEL_HEIGHT; y++)
+        for (x = 0; x < LCD_PIXEL_WIDTH; x++)
+            bad += remote[y][x] != LCD_SimGetPixel(x, y);
+    
+    LCD_ClientInit(&client, SimSink, 0);
+    SimRemote(&client, 1);
+    printf("scene: %lu bytes of commands + %lu bytes raw blit, %d pixels differ, "
+           "%d transfers held back\n",
+           (unsigned long)scene_bytes, (unsigned long)blit_bytes, bad, SimHeld);
+    printf("update: %lu bytes, %lu bytes/s at 10 Hz (a raw frame is %u bytes)\n",
+           (unsigned long)client.sent, (unsigned long)client.sent * 10,
+           LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT * 2);
+    return bad + SimHeld + (shot != 0);
+}
@@ -0,0 +1,91 @@
+/*
+ * Host demo for the SSD1289 driver. Draws a few test screens through the
+ * normal driver calls and writes what the panel would show to PPM files.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "SSD1289.h"
+#include "lcd_canvas.h"
+#include "lcd_dlist.h"
+
+static uint16_t Gradient[64 * 48];
+static LCD_DList DList;
+
+static void Dump(const char *path) {
+    if (LCD_SimDumpPPM(path) != 0)
+        fprintf(stderr, "cannot write %s\n", path);
+    else
+        printf("%s\n", path);
+}
+
+int main(int argc, char **argv) {
+    static const Point star[] = {
+        {160, 20}, {185, 95}, {260, 95}, {200, 140}, {225, 215},
+        {160, 170}, {95, 215}, {120, 140}, {60, 95}, {135, 95}
+    };
+    uint16_t x, y;
+    uint8_t stage;
+    
+    LCD_SimReset();
+    LCD_BootStart();
+    Init_LCD();
+    printf("device code %04X, FSMC write ADDSET %u DATAST %u, read ADDSET %u DATAST %u\n",
+           LCD_ReadReg(LCD_REG_0), LCD_FSMCWrite.addset, LCD_FSMCWrite.datast,
+           LCD_FSMCRead.addset, LCD_FSMCRead.datast);
+    for (stage = 0; stage < LCD_BootStageCount; stage++)
+        printf("boot: %-12s %8.2f ms\n", LCD_BootStages[stage].name,
+               LCD_BootStages[stage].cycles / 168000.0);
+    
+    /* "lcd_sim budget": check the transaction budgets instead of the demo */
+    if (argc > 1 && strcmp(argv[1], "budget") == 0)
+        return LCD_SimCheckBudgets() != 0;
+    /* "lcd_sim loopback": USB drawing commands against direct calls */
+    if (argc > 1 && strcmp(argv[1], "loopback") == 0)
+        return LCD_SimLoopback() != 0;
+    /* "lcd_sim rle": screenshot coding round trips */
+    if (argc > 1 && strcmp(argv[1], "rle") == 0)
+        return LCD_SimRLE() != 0;
+    
+    /* Primitives */
+    LCD_ClearDMA(WHITE);
+    LCD_FillRect(10, 10, 80, 40, RED);
+    LCD_FillPolygon(star, sizeof(star) / sizeof(star[0]), YELLOW);
+    LCD_DrawLine(0, 0, LCD_PIXEL_WIDTH - 1, LCD_PIXEL_HEIGHT - 1, BLUE);
+    LCD_FillCircle(270, 190, 30, GREEN);
+    LCD_SetTextColors(BLACK, WHITE);
+    LCD_DrawString(10, 220, "SSD1289 simulator");
+    LCD_DrawStringAA(180, 10, "AA text");
+    Dump("sim_primitives.ppm");
+    
+    /* DMA blit of a sub-rectangle with a stride */
+    for (y = 0; y < 48; y++)
+        for (x = 0; x < 64; x++)
+            Gradient[y * 64 + x] = ASSEMBLE_RGB(x * 4, y * 5, 255 - x * 4);
+    LCD_ClearDMA(BLACK);
+    LCD_DrawBitmapAsync(20, 20, 64, 48, Gradient, 64, 0);
+    LCD_DrawBitmapAsync(120, 20, 32, 24, Gradient + 16 * 64 + 16, 64, 0);
+    LCD_WaitDMA();
+    Dump("sim_blit.ppm");
+    
+    /* Canvas and display list */
+    LCD_ClearDMA(GREY);
+    if (LCD_CanvasInit(0, 0, LCD_PIXEL_WIDTH, 40, GREY)) {
+        LCD_CanvasFillRect(0, 0, LCD_PIXEL_WIDTH, 40, BLUE);
+        LCD_CanvasFillRect(100, 10, 120, 20, ORANGE);
+        LCD_Flush();
+    }
+    LCD_DListReset(&DList);
+    LCD_DListFill(&DList, 20, 60, 100, 100, RED);
+    LCD_DListBitmap(&DList, 140, 60, 64, 48, Gradient, 64);
+    LCD_DListText(&DList, 20, 180, "display list");
+    LCD_DListSubmit(&DList, 0);
+    LCD_DListWait();
+    Dump("sim_canvas.ppm");
+    
+    /* Hardware scroll */
+    LCD_SetScrollRegion(0, LCD_PIXEL_WIDTH);
+    LCD_ScrollTo(80);
+    Dump("sim_scroll.ppm");
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * Round trip of the screenshot run-length coding (lcd_rle.c). Each case is
+ * encoded, checked against LCD_RLE_MAX_BYTES(), then decoded once in one
+ * call and once fed a few bytes at a time, so tokens are cut off the way
+ * they are between the host's reads of a screenshot.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lcd_rle.h"
+
+#define SIM_RLE_PIXELS  (2 * LCD_RLE_MAX_TOKEN + 8)
+
+static uint16_t SimPixels[SIM_RLE_PIXELS];
+static uint16_t SimDecoded[SIM_RLE_PIXELS];
+static uint8_t  SimStream[LCD_RLE_MAX_BYTES(SIM_RLE_PIXELS)];
+
+/* Decode "length" bytes, handing the decoder "step" more of them per call */
+static uint32_t SimDecode(uint32_t length, uint32_t step) {
+    uint32_t used = 0, have = 0, count = 0, decoded;
+    
+    while (used < length) {
+        have = have + step > length ? length : have + step;
+        used += LCD_RLEDecode(SimStream + used, have - used, SimDecoded + count,
+                              SIM_RLE_PIXELS - count, &decoded);
+        count += decoded;
+        if (have == length && decoded == 0)
+            break;
+    }
+    return used == length ? count : 0;
+}
+
+static int SimRoundTrip(const char *name, uint32_t count, uint32_t expect_bytes) {
+    uint32_t length = LCD_RLEEncode(SimPixels, count, SimStream);
+    int bad = length > LCD_RLE_MAX_BYTES(count) || (expect_bytes && length != expect_bytes);
+    
+    memset(SimDecoded, 0xAA, sizeof(SimDecoded));
+    bad |= SimDecode(length, length) != count ||
+           memcmp(SimDecoded, SimPixels, count * 2) != 0;
+    memset(SimDecoded, 0xAA, sizeof(SimDecoded));
+    bad |= SimDecode(length, 3) != count || memcmp(SimDecoded, SimPixels, count * 2) != 0;
+    printf("%-24s %6lu pixels %7lu bytes%s\n", name, (unsigned long)count, (unsigned long)length,
+           bad ? "  FAILED" : "");
+    return bad;
+}
+
+/*
+ * Run every case and print the encoded sizes. Returns the number of cases
+ * that failed.
+ */
+int LCD_SimRLE(void) {
+    uint32_t i;
+    int failed = 0;
+    
+    for (i = 0; i < 320; i++)
+        SimPixels[i] = 0x1234;
+    failed += SimRoundTrip("flat row", 320, 4);
+    
+    for (i = 0; i < 320; i++)
+        SimPixels[i] = i & 1 ? 0xFFFF : 0x0000;
+    failed += SimRoundTrip("alternating row", 320, LCD_RLE_MAX_BYTES(320));
+    for (i = 0; i < SIM_RLE_PIXELS; i++)
+        SimPixels[i] = i & 1 ? 0xFFFF : 0x0000;
+    failed += SimRoundTrip("alternating, 2 tokens", LCD_RLE_MAX_TOKEN + 5,
+                           LCD_RLE_MAX_BYTES(LCD_RLE_MAX_TOKEN + 5));
+    
+    for (i = 0; i < SIM_RLE_PIXELS; i++)
+        SimPixels[i] = 0xF800;
+    failed += SimRoundTrip("run of one token", LCD_RLE_MAX_TOKEN, 4);
+    failed += SimRoundTrip("run, 1 pixel over", LCD_RLE_MAX_TOKEN + 1, 8);
+    failed += SimRoundTrip("run, 3 pixels over", LCD_RLE_MAX_TOKEN + 3, 8);
+    
+    /* Short repeats inside a literal, runs around it */
+    srand(1);
+    for (i = 0; i < SIM_RLE_PIXELS; i++)
+        SimPixels[i] = i % 97 < 40 ? 0x07E0 : (uint16_t)(rand() % 3);
+    failed += SimRoundTrip("mixed", SIM_RLE_PIXELS, 0);
+    return failed;
+}
@@ -27,24 +27,22 @@
 #include "usb_core.h"
 #include "usbd_core.h"
 #include "stm32f4_discovery.h"
-#include "usbd_hid_core.h"
+#include "SSD1289.h"
+#include "timer.h"
+#include "mems.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
-#define CURSOR_STEP     7
-
-extern uint8_t Buffer[6];
+/* LED demo period: 20 filter outputs at 50 Hz, 400 ms */
+#define MEMS_DEMO_OUTPUTS   20
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 extern __IO uint8_t DemoEnterCondition;
-uint8_t Counter  = 0x00;
-extern int8_t X_Offset;
-extern int8_t Y_Offset;
+static uint32_t DemoCount = 0;   /* MEMS view count at the last LED update */
 extern __IO uint8_t UserButtonPressed;
 __IO uint8_t TempAcceleration = 0;
 /* Private function prototypes -----------------------------------------------*/
 extern USB_OTG_CORE_HANDLE           USB_OTG_dev;
-static uint8_t *USBD_HID_GetPos (void);
 extern uint32_t USBD_OTG_ISR_Handler (USB_OTG_CORE_HANDLE *pdev);
 
 /******************************************************************************/
@@ -141,84 +139,80 @@ void PendSV_Handler(void)
 
 /**
   * @brief  This function handles SysTick Handler.
+  *         Only counts time; periodic work runs from software timers and
+  *         the scheduler in thread context (see main.c).
   * @param  None
   * @retval None
   */
 void SysTick_Handler(void)
 {
-  uint8_t *buf;
+  Timer_Tick();
+}
+
+/**
+  * @brief  MEMS demo step, formerly in the SysTick interrupt: every 400 ms
+  *         of filter outputs, updates the TIM4 LED pulses from the filtered
+  *         LIS302DL view (see mems.c). Runs in thread context and may be
+  *         called more often. The HID pointer report is gone, endpoint 0x81
+  *         belongs to the display class.
+  * @param  None
+  * @retval None
+  */
+void MEMS_Process(void)
+{
+  MEMS_View view;
   uint8_t temp1, temp2 = 0x00;
   
-  if (DemoEnterCondition == 0x00)
-  {
-    TimingDelay_Decrement();
-  }
-  else
+  MEMS_GetView(&view);
+  if (view.count - DemoCount >= MEMS_DEMO_OUTPUTS)
   {
-    buf = USBD_HID_GetPos();
-    if((buf[1] != 0) ||(buf[2] != 0))
-    {
-      USBD_HID_SendReport (&USB_OTG_dev, 
-                           buf,
-                           4);
-    } 
-    Counter ++;
-    if (Counter == 10)
-    {
-      Buffer[0] = 0;
-      Buffer[2] = 0;
-      /* Disable All TIM4 Capture Compare Channels */
-      TIM_CCxCmd(TIM4, TIM_Channel_1, DISABLE);
-      TIM_CCxCmd(TIM4, TIM_Channel_2, DISABLE);
-      TIM_CCxCmd(TIM4, TIM_Channel_3, DISABLE);
-      TIM_CCxCmd(TIM4, TIM_Channel_4, DISABLE);
-      
-      LIS302DL_Read(Buffer, LIS302DL_OUT_X_ADDR, 6);
-      /* Remove the offsets values from data */
-      Buffer[0] -= X_Offset;
-      Buffer[2] -= Y_Offset;
-      /* Update autoreload and capture compare registers value*/
-      temp1 = ABS((int8_t)(Buffer[0]));
-      temp2 = ABS((int8_t)(Buffer[2]));       
-      TempAcceleration = MAX(temp1, temp2);
+    /* Disable All TIM4 Capture Compare Channels */
+    TIM_CCxCmd(TIM4, TIM_Channel_1, DISABLE);
+    TIM_CCxCmd(TIM4, TIM_Channel_2, DISABLE);
+    TIM_CCxCmd(TIM4, TIM_Channel_3, DISABLE);
+    TIM_CCxCmd(TIM4, TIM_Channel_4, DISABLE);
+    
+    /* Offsets are already removed */
+    /* Update autoreload and capture compare registers value*/
+    temp1 = ABS(view.x);
+    temp2 = ABS(view.y);
+    TempAcceleration = MAX(temp1, temp2);
 
-      if(TempAcceleration != 0)
+    if(TempAcceleration != 0)
+    { 
+      if (view.x < -2)
+      {
+        /* Enable TIM4 Capture Compare Channel 4 */
+        TIM_CCxCmd(TIM4, TIM_Channel_4, ENABLE);
+        /* Sets the TIM4 Capture Compare4 Register value */
+        TIM_SetCompare4(TIM4, TIM_CCR/TempAcceleration);
+      }
+      if (view.x > 2)
+      {
+        /* Enable TIM4 Capture Compare Channel 2 */
+        TIM_CCxCmd(TIM4, TIM_Channel_2, ENABLE);
+        /* Sets the TIM4 Capture Compare2 Register value */
+        TIM_SetCompare2(TIM4, TIM_CCR/TempAcceleration);
+      }
+      if (view.y > 2)
       { 
-        if ((int8_t)Buffer[0] < -2)
-        {
-          /* Enable TIM4 Capture Compare Channel 4 */
-          TIM_CCxCmd(TIM4, TIM_Channel_4, ENABLE);
-          /* Sets the TIM4 Capture Compare4 Register value */
-          TIM_SetCompare4(TIM4, TIM_CCR/TempAcceleration);
-        }
-        if ((int8_t)Buffer[0] > 2)
-        {
-          /* Enable TIM4 Capture Compare Channel 2 */
-          TIM_CCxCmd(TIM4, TIM_Channel_2, ENABLE);
-          /* Sets the TIM4 Capture Compare2 Register value */
-          TIM_SetCompare2(TIM4, TIM_CCR/TempAcceleration);
-        }
-        if ((int8_t)Buffer[2] > 2)
-        { 
-          /* Enable TIM4 Capture Compare Channel 1 */
-          TIM_CCxCmd(TIM4, TIM_Channel_1, ENABLE);
-          /* Sets the TIM4 Capture Compare1 Register value */
-          TIM_SetCompare1(TIM4, TIM_CCR/TempAcceleration);
-        }      
-        if ((int8_t)Buffer[2] < -2)
-        { 
-          /* Enable TIM4 Capture Compare Channel 3 */
-          TIM_CCxCmd(TIM4, TIM_Channel_3, ENABLE);
-          /* Sets the TIM4 Capture Compare3 Register value */
-          TIM_SetCompare3(TIM4, TIM_CCR/TempAcceleration);
-        }
-        /* Time base configuration */
-        TIM_SetAutoreload(TIM4,  TIM_ARR/TempAcceleration);
+        /* Enable TIM4 Capture Compare Channel 1 */
+        TIM_CCxCmd(TIM4, TIM_Channel_1, ENABLE);
+        /* Sets the TIM4 Capture Compare1 Register value */
+        TIM_SetCompare1(TIM4, TIM_CCR/TempAcceleration);
+      }      
+      if (view.y < -2)
+      { 
+        /* Enable TIM4 Capture Compare Channel 3 */
+        TIM_CCxCmd(TIM4, TIM_Channel_3, ENABLE);
+        /* Sets the TIM4 Capture Compare3 Register value */
+        TIM_SetCompare3(TIM4, TIM_CCR/TempAcceleration);
       }
-      Counter = 0x00;
-    }  
-  }
-  
+      /* Time base configuration */
+      TIM_SetAutoreload(TIM4,  TIM_ARR/TempAcceleration);
+    }
+    DemoCount = view.count;
+  }  
 }
 
 /******************************************************************************/
@@ -250,6 +244,36 @@ void EXTI0_IRQHandler(void)
   EXTI_ClearITPendingBit(USER_BUTTON_EXTI_LINE);
 }
 
+/**
+  * @brief  This function handles DMA2 Stream0 (LCD transfers) Handler.
+  * @param  None
+  * @retval None
+  */
+void DMA2_Stream0_IRQHandler(void)
+{
+  LCD_DMA_IRQHandler();
+}
+
+/**
+  * @brief  This function handles EXTI1 (LIS302DL data ready) Handler.
+  * @param  None
+  * @retval None
+  */
+void EXTI1_IRQHandler(void)
+{
+  MEMS_DRDY_IRQHandler();
+}
+
+/**
+  * @brief  This function handles DMA2 Stream2 (LIS302DL SPI read) Handler.
+  * @param  None
+  * @retval None
+  */
+void DMA2_Stream2_IRQHandler(void)
+{
+  MEMS_DMA_IRQHandler();
+}
+
 /**
   * @brief  This function handles EXTI15_10_IRQ Handler.
   * @param  None
@@ -279,38 +303,4 @@ void OTG_FS_IRQHandler(void)
   USBD_OTG_ISR_Handler (&USB_OTG_dev);
 }
 
-/**
-* @brief  USBD_HID_GetPos
-* @param  None
-* @retval Pointer to report
-*/
-static uint8_t *USBD_HID_GetPos (void)
-{
-  static uint8_t HID_Buffer[4] = {0};
-  
-  HID_Buffer[1] = 0;
-  HID_Buffer[2] = 0;
-  /* LEFT Direction */
-  if(((int8_t)Buffer[2]) < -2)
-  {
-    HID_Buffer[1] += CURSOR_STEP;
-  }
-  /* RIGHT Direction */ 
-  if(((int8_t)Buffer[2]) > 2)
-  {
-   HID_Buffer[1] -= CURSOR_STEP;
-  } 
-  /* UP Direction */
-  if(((int8_t)Buffer[0]) < -2)
-  {
-    HID_Buffer[2] += CURSOR_STEP;
-  }
-  /* DOWN Direction */ 
-  if(((int8_t)Buffer[0]) > 2)
-  {
-    HID_Buffer[2] -= CURSOR_STEP;
-  } 
-  
-  return HID_Buffer;
-}
 /******************* (C) COPYRIGHT 2011 STMicroelectronics *****END OF FILE****/
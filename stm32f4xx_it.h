@@ -44,6 +44,7 @@ void SVC_Handler(void);
 void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
+void MEMS_Process(void);
 
 #ifdef __cplusplus
 }
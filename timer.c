@@ -0,0 +1,108 @@
+/*
+ * Software timers on the 1 ms SysTick, see timer.h.
+ */
+
+#include "timer.h"
+#include "stm32f4xx.h"
+
+static __IO uint32_t Timer_Ticks = 0;
+static Timer *Timer_List = 0;           /* active timers, unsorted */
+
+/* "tick" is now or in the past, correct across the 32 bit wrap */
+#define TIMER_REACHED(tick, now)   ((int32_t)((now) - (tick)) >= 0)
+
+/* SysTick interrupt, every millisecond */
+void Timer_Tick(void) {
+    Timer_Ticks++;
+}
+
+/* Milliseconds since Init_SysTick(), wraps after 49 days */
+uint32_t Timer_Now(void) {
+    return Timer_Ticks;
+}
+
+/*
+ * Call "callback" with "context" in "delay" ms (at least 1), then every
+ * "period" ms unless that is 0. Restarts the timer if it is active.
+ */
+void Timer_Start(Timer *timer, uint32_t delay, uint32_t period,
+                 Timer_Callback callback, void *context) {
+    /* The next tick may come right away, one more keeps the minimum */
+    timer->deadline = Timer_Ticks + (delay ? delay : 1) + 1;
+    timer->period = period;
+    timer->callback = callback;
+    timer->context = context;
+    if (!timer->active) {
+        timer->next = Timer_List;
+        Timer_List = timer;
+        timer->active = 1;
+    }
+}
+
+void Timer_Stop(Timer *timer) {
+    Timer **link;
+    
+    if (!timer->active)
+        return;
+    for (link = &Timer_List; *link; link = &(*link)->next) {
+        if (*link == timer) {
+            *link = timer->next;
+            break;
+        }
+    }
+    timer->active = 0;
+}
+
+uint8_t Timer_Active(const Timer *timer) {
+    return timer->active;
+}
+
+static Timer *Timer_FindDue(uint32_t now) {
+    Timer *timer;
+    
+    for (timer = Timer_List; timer; timer = timer->next)
+        if (TIMER_REACHED(timer->deadline, now))
+            return timer;
+    return 0;
+}
+
+/* Something to do for Timer_Poll() */
+uint8_t Timer_Due(void) {
+    return Timer_FindDue(Timer_Ticks) != 0;
+}
+
+/*
+ * Run the callbacks of all due timers, call from the main loop. A periodic
+ * timer that fell behind skips the missed periods instead of firing for
+ * each of them. Callbacks may start and stop timers, themselves included.
+ * Returns the number of callbacks run.
+ */
+uint8_t Timer_Poll(void) {
+    uint32_t now = Timer_Ticks;
+    uint8_t count = 0;
+    Timer *timer;
+    
+    while ((timer = Timer_FindDue(now)) != 0) {
+        if (timer->period) {
+            timer->deadline += timer->period;
+            if (TIMER_REACHED(timer->deadline, now))
+                timer->deadline = now + timer->period;
+        }else{
+            Timer_Stop(timer);
+        }
+        timer->callback(timer->context);
+        count++;
+    }
+    return count;
+}
+
+/*
+ * Sleep until the next interrupt unless a timer is due. Interrupts are
+ * masked around the check so one that comes in between still ends WFI.
+ */
+void Timer_Sleep(void) {
+    __disable_irq();
+    if (!Timer_Due())
+        __WFI();
+    __enable_irq();
+}
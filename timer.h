@@ -0,0 +1,39 @@
+/*
+ * Software timers on the 1 ms SysTick (Init_SysTick()).
+ *
+ * The interrupt only counts ticks. Timer_Poll(), called from the main loop,
+ * runs the callbacks of timers that are due, so they run in thread context
+ * and may draw. Timer_Sleep() stops the core with WFI until the next
+ * interrupt when nothing is due; Delay() sleeps the same way.
+ *
+ * Timer structs belong to the caller and must stay valid while active.
+ * Start and stop them from thread context only.
+ */
+
+#ifndef __TIMER_H
+#define __TIMER_H
+
+#include <stdint.h>
+
+typedef void (*Timer_Callback)(void *context);
+
+typedef struct Timer {
+    struct Timer   *next;
+    uint32_t        deadline;   /* tick it fires at */
+    uint32_t        period;     /* ticks between calls, 0 for one-shot */
+    Timer_Callback  callback;
+    void           *context;
+    uint8_t         active;
+} Timer;
+
+void Timer_Tick(void);
+uint32_t Timer_Now(void);
+void Timer_Start(Timer *timer, uint32_t delay, uint32_t period,
+                 Timer_Callback callback, void *context);
+void Timer_Stop(Timer *timer);
+uint8_t Timer_Active(const Timer *timer);
+uint8_t Timer_Poll(void);
+uint8_t Timer_Due(void);
+void Timer_Sleep(void);
+
+#endif /* __TIMER_H */
@@ -54,6 +54,12 @@
 #define HID_IN_PACKET                4
 #define HID_OUT_PACKET               4
 
+/* Vendor bulk class of the display, see usbd_lcd_core.c */
+#define LCD_USB_IN_EP                0x81
+#define LCD_USB_OUT_EP               0x01
+#define LCD_USB_PACKET               64
+#define LCD_USB_RX_SIZE              2048    /* each of the two OUT buffers */
+
 /**
   * @}
   */ 
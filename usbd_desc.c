@@ -25,6 +25,7 @@
 #include "usbd_req.h"
 #include "usbd_conf.h"
 #include "usb_regs.h"
+#include "lcd_usb_proto.h"
 
 /** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
   * @{
@@ -48,23 +49,23 @@
   * @{
   */ 
 
-#define USBD_VID                     0x0483
-#define USBD_PID                     0x5710
+#define USBD_VID                     LCD_USB_VID
+#define USBD_PID                     LCD_USB_PID
 
 #define USBD_LANGID_STRING            0x409
 #define USBD_MANUFACTURER_STRING      "STMicroelectronics"
 
-#define USBD_PRODUCT_HS_STRING        "Joystick in HS mode"
+#define USBD_PRODUCT_HS_STRING        "SSD1289 LCD in HS mode"
 #define USBD_SERIALNUMBER_HS_STRING   "00000000011B"
 
-#define USBD_PRODUCT_FS_STRING        "Joystick in FS Mode"
+#define USBD_PRODUCT_FS_STRING        "SSD1289 LCD in FS mode"
 #define USBD_SERIALNUMBER_FS_STRING   "00000000011C"
 
-#define USBD_CONFIGURATION_HS_STRING  "HID Config"
-#define USBD_INTERFACE_HS_STRING      "HID Interface"
+#define USBD_CONFIGURATION_HS_STRING  "LCD Config"
+#define USBD_INTERFACE_HS_STRING      "LCD Interface"
 
-#define USBD_CONFIGURATION_FS_STRING  "HID Config"
-#define USBD_INTERFACE_FS_STRING      "HID Interface"
+#define USBD_CONFIGURATION_FS_STRING  "LCD Config"
+#define USBD_INTERFACE_FS_STRING      "LCD Interface"
 /**
   * @}
   */ 
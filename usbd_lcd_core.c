@@ -0,0 +1,310 @@
+/**
+  ******************************************************************************
+  * @file    usbd_lcd_core.c
+  * @brief   Vendor specific bulk class for the SSD1289 display.
+  *
+  *          The host sends requests on the bulk OUT endpoint and reads
+  *          replies from the bulk IN endpoint. This file only moves the
+  *          data; requests are handled in thread context by lcd_usb.c,
+  *          never from the USB interrupt, because they touch the LCD bus.
+  *
+  *          OUT data goes to two buffers in turn. While lcd_usb.c works on
+  *          a full one the other one receives, and the endpoint NAKs only
+  *          when both are full.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_lcd_core.h"
+#include "usbd_desc.h"
+#include "usbd_req.h"
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t  USBD_LCD_Init (void *pdev, uint8_t cfgidx);
+static uint8_t  USBD_LCD_DeInit (void *pdev, uint8_t cfgidx);
+static uint8_t  USBD_LCD_Setup (void *pdev, USB_SETUP_REQ *req);
+static uint8_t  USBD_LCD_DataIn (void *pdev, uint8_t epnum);
+static uint8_t  USBD_LCD_DataOut (void *pdev, uint8_t epnum);
+static uint8_t  *USBD_LCD_GetCfgDesc (uint8_t speed, uint16_t *length);
+
+/* Private variables ---------------------------------------------------------*/
+USBD_Class_cb_TypeDef  USBD_LCD_cb =
+{
+  USBD_LCD_Init,
+  USBD_LCD_DeInit,
+  USBD_LCD_Setup,
+  NULL, /*EP0_TxSent*/
+  NULL, /*EP0_RxReady*/
+  USBD_LCD_DataIn,
+  USBD_LCD_DataOut,
+  NULL, /*SOF */
+  NULL,
+  NULL,
+  USBD_LCD_GetCfgDesc,
+#ifdef USB_OTG_HS_CORE
+  USBD_LCD_GetCfgDesc, /* use same config as per FS */
+#endif
+};
+
+#define USBD_LCD_RX_FREE    0
+#define USBD_LCD_RX_ARMED   1   /* endpoint receives into it */
+#define USBD_LCD_RX_FULL    2   /* waits for lcd_usb.c */
+
+static void              *USBD_LCD_Device = NULL;
+static __IO uint8_t      USBD_LCD_TxActive = 0;
+static __IO uint8_t      USBD_LCD_SessionCount = 0;
+static __IO uint8_t      USBD_LCD_RxState[2];
+static __IO uint16_t     USBD_LCD_RxLength[2];
+static uint8_t           USBD_LCD_RxHead = 0;     /* oldest full buffer */
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t USBD_LCD_RxBuffer[2][LCD_USB_RX_SIZE] __ALIGN_END;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+/* USB LCD device Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_LCD_CfgDesc[USB_LCD_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  0x09, /* bLength: Configuration Descriptor size */
+  USB_CONFIGURATION_DESCRIPTOR_TYPE, /* bDescriptorType: Configuration */
+  USB_LCD_CONFIG_DESC_SIZ,
+  0x00,         /* wTotalLength */
+  0x01,         /* bNumInterfaces: 1 interface */
+  0x01,         /* bConfigurationValue */
+  0x00,         /* iConfiguration */
+  0xC0,         /* bmAttributes: self powered */
+  0x32,         /* MaxPower 100 mA */
+
+  /************** Vendor interface ****************/
+  0x09,         /* bLength: Interface Descriptor size */
+  USB_INTERFACE_DESCRIPTOR_TYPE,
+  0x00,         /* bInterfaceNumber */
+  0x00,         /* bAlternateSetting */
+  0x02,         /* bNumEndpoints */
+  USB_LCD_INTERFACE_CLASS,
+  0x00,         /* bInterfaceSubClass */
+  0x00,         /* nInterfaceProtocol */
+  0x00,         /* iInterface */
+
+  /******************** Bulk OUT ******************/
+  0x07,         /* bLength: Endpoint Descriptor size */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,
+  LCD_USB_OUT_EP,
+  0x02,         /* bmAttributes: bulk */
+  LOBYTE(LCD_USB_PACKET),
+  HIBYTE(LCD_USB_PACKET),
+  0x00,         /* bInterval: ignored for bulk */
+
+  /******************** Bulk IN *******************/
+  0x07,
+  USB_ENDPOINT_DESCRIPTOR_TYPE,
+  LCD_USB_IN_EP,
+  0x02,
+  LOBYTE(LCD_USB_PACKET),
+  HIBYTE(LCD_USB_PACKET),
+  0x00,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+static void  USBD_LCD_Arm (void *pdev, uint8_t index)
+{
+  USBD_LCD_RxState[index] = USBD_LCD_RX_ARMED;
+  DCD_EP_PrepareRx(pdev, LCD_USB_OUT_EP, USBD_LCD_RxBuffer[index], LCD_USB_RX_SIZE);
+}
+
+/**
+  * @brief  USBD_LCD_Init
+  *         Open the bulk endpoints and wait for the first request
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_LCD_Init (void *pdev, uint8_t cfgidx)
+{
+  DCD_EP_Open(pdev, LCD_USB_IN_EP, LCD_USB_PACKET, USB_OTG_EP_BULK);
+  DCD_EP_Open(pdev, LCD_USB_OUT_EP, LCD_USB_PACKET, USB_OTG_EP_BULK);
+
+  USBD_LCD_Device = pdev;
+  USBD_LCD_TxActive = 0;
+  USBD_LCD_RxState[0] = USBD_LCD_RX_FREE;
+  USBD_LCD_RxState[1] = USBD_LCD_RX_FREE;
+  USBD_LCD_RxHead = 0;
+  USBD_LCD_SessionCount++;
+  USBD_LCD_Arm(pdev, 0);
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_LCD_DeInit
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_LCD_DeInit (void *pdev, uint8_t cfgidx)
+{
+  DCD_EP_Close(pdev, LCD_USB_IN_EP);
+  DCD_EP_Close(pdev, LCD_USB_OUT_EP);
+  USBD_LCD_Device = NULL;
+  USBD_LCD_TxActive = 0;
+  USBD_LCD_SessionCount++;
+  USBD_LCD_Notify();
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_LCD_Setup
+  *         No class or vendor control requests
+  * @param  pdev: instance
+  * @param  req: usb requests
+  * @retval status
+  */
+static uint8_t  USBD_LCD_Setup (void *pdev, USB_SETUP_REQ *req)
+{
+  if ((req->bmRequest & USB_REQ_TYPE_MASK) != USB_REQ_TYPE_STANDARD)
+  {
+    USBD_CtlError(pdev, req);
+    return USBD_FAIL;
+  }
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_LCD_DataIn
+  *         An IN transfer is complete
+  * @param  pdev: device instance
+  * @param  epnum: endpoint index
+  * @retval status
+  */
+static uint8_t  USBD_LCD_DataIn (void *pdev, uint8_t epnum)
+{
+  USBD_LCD_TxActive = 0;
+  USBD_LCD_Notify();
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_LCD_DataOut
+  *         A buffer is complete (full or ended by a short packet). Keep it
+  *         for lcd_usb.c and receive into the other one if it is free.
+  * @param  pdev: device instance
+  * @param  epnum: endpoint index
+  * @retval status
+  */
+static uint8_t  USBD_LCD_DataOut (void *pdev, uint8_t epnum)
+{
+  uint8_t index = USBD_LCD_RxState[0] == USBD_LCD_RX_ARMED ? 0 : 1;
+  uint16_t length = USBD_GetRxCount(pdev, epnum);
+
+  /* A zero length packet carries nothing, listen again */
+  if (length == 0)
+  {
+    USBD_LCD_Arm(pdev, index);
+    return USBD_OK;
+  }
+  USBD_LCD_RxLength[index] = length;
+  USBD_LCD_RxState[index] = USBD_LCD_RX_FULL;
+  if (USBD_LCD_RxState[index ^ 1] == USBD_LCD_RX_FREE)
+    USBD_LCD_Arm(pdev, index ^ 1);
+  USBD_LCD_Notify();
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_LCD_GetCfgDesc
+  *         return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_LCD_GetCfgDesc (uint8_t speed, uint16_t *length)
+{
+  *length = sizeof (USBD_LCD_CfgDesc);
+  return USBD_LCD_CfgDesc;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  USBD_LCD_Configured
+  * @retval 1 once the host selected the configuration
+  */
+uint8_t  USBD_LCD_Configured (void)
+{
+  return USBD_LCD_Device != NULL;
+}
+
+/**
+  * @brief  USBD_LCD_Session
+  *         Changes on every configure and unconfigure (reset, unplug),
+  *         so lcd_usb.c can drop a request the host abandoned
+  * @retval session number
+  */
+uint8_t  USBD_LCD_Session (void)
+{
+  return USBD_LCD_SessionCount;
+}
+
+/**
+  * @brief  USBD_LCD_Send
+  *         Start an IN transfer. "data" has to stay valid until
+  *         USBD_LCD_TxBusy() returns 0. A length that is a multiple of the
+  *         packet size needs a zero length transfer after it to end the
+  *         host read.
+  * @param  data: bytes to send
+  * @param  length: number of bytes, 0 sends a zero length packet
+  * @retval USBD_OK, USBD_BUSY or USBD_FAIL when not configured
+  */
+uint8_t  USBD_LCD_Send (const uint8_t *data, uint16_t length)
+{
+  if (USBD_LCD_Device == NULL)
+    return USBD_FAIL;
+  if (USBD_LCD_TxActive)
+    return USBD_BUSY;
+  USBD_LCD_TxActive = 1;
+  DCD_EP_Tx(USBD_LCD_Device, LCD_USB_IN_EP, (uint8_t *)data, length);
+  return USBD_OK;
+}
+
+uint8_t  USBD_LCD_TxBusy (void)
+{
+  return USBD_LCD_TxActive;
+}
+
+/**
+  * @brief  USBD_LCD_Received
+  * @param  data: set to the oldest received buffer
+  * @retval number of bytes in it, 0 if nothing arrived
+  */
+uint16_t USBD_LCD_Received (uint8_t **data)
+{
+  if (USBD_LCD_RxState[USBD_LCD_RxHead] != USBD_LCD_RX_FULL)
+    return 0;
+  *data = USBD_LCD_RxBuffer[USBD_LCD_RxHead];
+  return USBD_LCD_RxLength[USBD_LCD_RxHead];
+}
+
+/**
+  * @brief  USBD_LCD_Release
+  *         Done with the oldest buffer. If the endpoint stopped because
+  *         both buffers were full, it receives into this one again.
+  */
+void     USBD_LCD_Release (void)
+{
+  uint8_t index = USBD_LCD_RxHead;
+
+  if (USBD_LCD_Device == NULL || USBD_LCD_RxState[index] != USBD_LCD_RX_FULL)
+    return;
+  USBD_LCD_RxState[index] = USBD_LCD_RX_FREE;
+  USBD_LCD_RxHead ^= 1;
+  /* Without an armed buffer no DataOut can come in between */
+  if (USBD_LCD_RxState[0] != USBD_LCD_RX_ARMED && USBD_LCD_RxState[1] != USBD_LCD_RX_ARMED)
+    USBD_LCD_Arm(USBD_LCD_Device, index);
+}
@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * @file    usbd_lcd_core.h
+  * @brief   Vendor specific bulk class for the SSD1289 display (header).
+  ******************************************************************************
+  */
+
+#ifndef __USBD_LCD_CORE_H
+#define __USBD_LCD_CORE_H
+
+#include "usbd_ioreq.h"
+
+/* One interface, class 0xFF, a bulk IN and a bulk OUT endpoint */
+#define USB_LCD_CONFIG_DESC_SIZ       32
+#define USB_LCD_INTERFACE_CLASS       0xFF
+
+extern USBD_Class_cb_TypeDef  USBD_LCD_cb;
+
+uint8_t  USBD_LCD_Configured (void);
+uint8_t  USBD_LCD_Session (void);
+uint8_t  USBD_LCD_Send (const uint8_t *data, uint16_t length);
+uint8_t  USBD_LCD_TxBusy (void);
+uint16_t USBD_LCD_Received (uint8_t **data);
+void     USBD_LCD_Release (void);
+
+/* Provided by the application, called from the USB interrupt when OUT data
+   arrived or an IN transfer finished */
+void     USBD_LCD_Notify (void);
+
+#endif /* __USBD_LCD_CORE_H */
@@ -111,13 +111,8 @@ USBD_Usr_cb_TypeDef USR_cb =
 */
 void USBD_USR_Init(void)
 {   
-  /* Setup SysTick Timer for 40 msec interrupts 
-  This interrupt is used to probe the joystick */
-  if (SysTick_Config(SystemCoreClock / 24))
-  { 
-    /* Capture error */ 
-    while (1);
-  }
+  /* SysTick keeps its 1 ms period from Init_SysTick(), Delay() and the
+  software timers in timer.c count on it */
 }
 
 /**